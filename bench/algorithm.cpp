@@ -0,0 +1,542 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Every algorithm in <stl2/algorithm.hpp>, and sample, against its std::
+// counterpart (ext::radix_sort against std::sort).
+//
+#include <stl2/algorithm.hpp>
+#include <stl2/detail/algorithm/sample.hpp>
+#include <stl2/execution.hpp>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	using vec = std::vector<int>;
+
+	constexpr auto odd = [](int i) { return (i & 1) != 0; };
+	constexpr auto negative = [](int i) { return i < 0; };
+	constexpr auto non_negative = [](int i) { return i >= 0; };
+	constexpr auto twice = [](int i) { return 2 * i; };
+
+	// An operation on the generated data.
+	template<class F, class G>
+	void reading(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto const v = ctx.generate<int>();
+			ctx.run("stl2", [&]{ return stl2_op(v); });
+			ctx.run("std", [&]{ return std_op(v); });
+		});
+	}
+
+	// An operation on the generated data, sorted.
+	template<class F, class G>
+	void reading_sorted(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto v = ctx.generate<int>();
+			std::sort(v.begin(), v.end());
+			ctx.run("stl2", [&]{ return stl2_op(static_cast<const vec&>(v)); });
+			ctx.run("std", [&]{ return std_op(static_cast<const vec&>(v)); });
+		});
+	}
+
+	// An operation on the generated data and an equal copy of it.
+	template<class F, class G>
+	void reading2(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto const a = ctx.generate<int>();
+			auto const b = a;
+			ctx.run("stl2", [&]{ return stl2_op(a, b); });
+			ctx.run("std", [&]{ return std_op(a, b); });
+		});
+	}
+
+	// An operation that writes the generated data, or some of it, to an
+	// output sequence of twice its size.
+	template<class F, class G>
+	void copying(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto const v = ctx.generate<int>();
+			vec out(2 * v.size());
+			ctx.run("stl2", [&]{ return stl2_op(v, out); });
+			ctx.run("std", [&]{ return std_op(v, out); });
+		});
+	}
+
+	// An operation that merges two sorted sequences that half overlap
+	// into an output sequence.
+	template<class F, class G>
+	void merging(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto a = ctx.generate<int>();
+			std::sort(a.begin(), a.end());
+			auto b = a;
+			for (auto& i : b) {
+				i += static_cast<int>(ctx.size() / 2);
+			}
+			vec out(a.size() + b.size());
+			ctx.run("stl2", [&]{ return stl2_op(a, b, out); });
+			ctx.run("std", [&]{ return std_op(a, b, out); });
+		});
+	}
+
+	// An operation that modifies a fresh copy of the data prepared by
+	// prep, which defaults to the generated data itself.
+	template<class F, class G, class P = std::nullptr_t>
+	void mutating(const char* name, F stl2_op, G std_op, P prep = nullptr) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto data = ctx.generate<int>();
+			if constexpr (!std::is_same<P, std::nullptr_t>::value) {
+				prep(data);
+			}
+			vec v;
+			ctx.reset([&]{ v = data; });
+			ctx.run("stl2", [&]{ return stl2_op(v); });
+			ctx.run("std", [&]{ return std_op(v); });
+		});
+	}
+
+	// An operation that modifies the data in a way that can be repeated
+	// without resetting it.
+	template<class F, class G>
+	void repeatable(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) mutable {
+			auto v = ctx.generate<int>();
+			ctx.run("stl2", [&]{ return stl2_op(v); });
+			ctx.run("std", [&]{ return std_op(v); });
+		});
+	}
+
+	// An input iterator over ints, so that an algorithm can't learn the
+	// length of its input in advance.
+	class input_only {
+		const int* p_ = nullptr;
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = int;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const int*;
+		using reference = const int&;
+
+		input_only() = default;
+		explicit input_only(const int* p) noexcept : p_{p} {}
+
+		const int& operator*() const noexcept { return *p_; }
+		input_only& operator++() noexcept { ++p_; return *this; }
+		input_only operator++(int) noexcept { auto tmp = *this; ++p_; return tmp; }
+
+		friend bool operator==(input_only a, input_only b) noexcept { return a.p_ == b.p_; }
+		friend bool operator!=(input_only a, input_only b) noexcept { return a.p_ != b.p_; }
+	};
+	static_assert(stl2::InputIterator<input_only> && !stl2::ForwardIterator<input_only> &&
+		!stl2::SizedSentinel<input_only, input_only>);
+
+	// A sample of one in a hundred of the generated data, from a range
+	// whose size is known (sized) or only found by reading it (streaming).
+	template<bool Sized>
+	void sampling(const char* name) {
+		bench::add("algorithm", name, [](bench::context& ctx) {
+			auto const v = ctx.generate<int>();
+			vec out(std::max<std::size_t>(v.size() / 100, 1));
+			auto const n = static_cast<std::ptrdiff_t>(out.size());
+			std::mt19937 gen{1};
+			if constexpr (Sized) {
+				ctx.run("stl2", [&]{ return stl2::sample(v, out.begin(), n, gen).out(); });
+				ctx.run("std", [&]{ return std::sample(v.begin(), v.end(), out.begin(), n, gen); });
+			} else {
+				input_only const first{v.data()}, last{v.data() + v.size()};
+				ctx.run("stl2", [&]{ return stl2::sample(first, last, out.begin(), n, gen).out(); });
+				ctx.run("std", [&]{ return std::sample(first, last, out.begin(), n, gen); });
+			}
+		});
+	}
+
+	auto const heap_data = [](vec& v) { std::make_heap(v.begin(), v.end()); };
+	auto const sort_halves = [](vec& v) {
+		std::sort(v.begin(), v.begin() + v.size() / 2);
+		std::sort(v.begin() + v.size() / 2, v.end());
+	};
+
+	// The keys searched for by each call of the binary searches.
+	vec search_keys(const vec& v) {
+		vec keys(64);
+		std::mt19937 gen{42};
+		for (auto& k : keys) {
+			k = v.empty() ? 0 : v[gen() % v.size()];
+		}
+		return keys;
+	}
+
+	template<class F, class G>
+	void searching(const char* name, F stl2_op, G std_op) {
+		bench::add("algorithm", name, [=](bench::context& ctx) {
+			auto v = ctx.generate<int>();
+			std::sort(v.begin(), v.end());
+			auto const keys = search_keys(v);
+			ctx.run("stl2", [&]{
+				std::ptrdiff_t sum = 0;
+				for (int k : keys) {
+					sum += stl2_op(static_cast<const vec&>(v), k);
+				}
+				return sum;
+			});
+			ctx.run("std", [&]{
+				std::ptrdiff_t sum = 0;
+				for (int k : keys) {
+					sum += std_op(static_cast<const vec&>(v), k);
+				}
+				return sum;
+			});
+		});
+	}
+
+	void register_non_modifying() {
+		reading("adjacent_find",
+			[](auto& v) { return stl2::adjacent_find(v); },
+			[](auto& v) { return std::adjacent_find(v.begin(), v.end()); });
+		reading("all_of",
+			[](auto& v) { return stl2::all_of(v, non_negative); },
+			[](auto& v) { return std::all_of(v.begin(), v.end(), non_negative); });
+		reading("any_of",
+			[](auto& v) { return stl2::any_of(v, negative); },
+			[](auto& v) { return std::any_of(v.begin(), v.end(), negative); });
+		reading("none_of",
+			[](auto& v) { return stl2::none_of(v, negative); },
+			[](auto& v) { return std::none_of(v.begin(), v.end(), negative); });
+		reading("count",
+			[](auto& v) { return stl2::count(v, 1); },
+			[](auto& v) { return std::count(v.begin(), v.end(), 1); });
+		reading("count_if",
+			[](auto& v) { return stl2::count_if(v, odd); },
+			[](auto& v) { return std::count_if(v.begin(), v.end(), odd); });
+		reading("find",
+			[](auto& v) { return stl2::find(v, -1); },
+			[](auto& v) { return std::find(v.begin(), v.end(), -1); });
+		reading("find_if",
+			[](auto& v) { return stl2::find_if(v, negative); },
+			[](auto& v) { return std::find_if(v.begin(), v.end(), negative); });
+		reading("find_if_not",
+			[](auto& v) { return stl2::find_if_not(v, non_negative); },
+			[](auto& v) { return std::find_if_not(v.begin(), v.end(), non_negative); });
+		reading("find_end",
+			[](auto& v) { int const n[] = {-1, -2}; return stl2::find_end(v, n); },
+			[](auto& v) { int const n[] = {-1, -2}; return std::find_end(v.begin(), v.end(), n, n + 2); });
+		reading("find_first_of",
+			[](auto& v) { int const n[] = {-1, -2, -3, -4}; return stl2::find_first_of(v, n); },
+			[](auto& v) {
+				int const n[] = {-1, -2, -3, -4};
+				return std::find_first_of(v.begin(), v.end(), n, n + 4);
+			});
+		reading("for_each",
+			[](auto& v) { long s = 0; stl2::for_each(v, [&](int i) { s += i; }); return s; },
+			[](auto& v) { long s = 0; std::for_each(v.begin(), v.end(), [&](int i) { s += i; }); return s; });
+		reading("search",
+			[](auto& v) { int const n[] = {-1, -2}; return stl2::search(v, n); },
+			[](auto& v) { int const n[] = {-1, -2}; return std::search(v.begin(), v.end(), n, n + 2); });
+		reading("search_n",
+			[](auto& v) { return stl2::search_n(v, 2, -1); },
+			[](auto& v) { return std::search_n(v.begin(), v.end(), 2, -1); });
+		reading("is_sorted",
+			[](auto& v) { return stl2::is_sorted(v); },
+			[](auto& v) { return std::is_sorted(v.begin(), v.end()); });
+		reading("is_sorted_until",
+			[](auto& v) { return stl2::is_sorted_until(v); },
+			[](auto& v) { return std::is_sorted_until(v.begin(), v.end()); });
+		reading("is_heap",
+			[](auto& v) { return stl2::is_heap(v); },
+			[](auto& v) { return std::is_heap(v.begin(), v.end()); });
+		reading("is_heap_until",
+			[](auto& v) { return stl2::is_heap_until(v); },
+			[](auto& v) { return std::is_heap_until(v.begin(), v.end()); });
+		reading("is_partitioned",
+			[](auto& v) { return stl2::is_partitioned(v, odd); },
+			[](auto& v) { return std::is_partitioned(v.begin(), v.end(), odd); });
+		reading("max_element",
+			[](auto& v) { return stl2::max_element(v); },
+			[](auto& v) { return std::max_element(v.begin(), v.end()); });
+		reading("min_element",
+			[](auto& v) { return stl2::min_element(v); },
+			[](auto& v) { return std::min_element(v.begin(), v.end()); });
+		reading("minmax_element",
+			[](auto& v) { return stl2::minmax_element(v); },
+			[](auto& v) { return std::minmax_element(v.begin(), v.end()); });
+		reading("max",
+			[](auto& v) { return v.empty() ? 0 : stl2::max(v); },
+			[](auto& v) { return v.empty() ? 0 : *std::max_element(v.begin(), v.end()); });
+		reading("min",
+			[](auto& v) { return v.empty() ? 0 : stl2::min(v); },
+			[](auto& v) { return v.empty() ? 0 : *std::min_element(v.begin(), v.end()); });
+		reading("minmax",
+			[](auto& v) { return v.empty() ? 0 : stl2::minmax(v).first; },
+			[](auto& v) { return v.empty() ? 0 : *std::minmax_element(v.begin(), v.end()).first; });
+
+		reading2("equal",
+			[](auto& a, auto& b) { return stl2::equal(a, b); },
+			[](auto& a, auto& b) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); });
+		reading2("mismatch",
+			[](auto& a, auto& b) { return stl2::mismatch(a, b); },
+			[](auto& a, auto& b) { return std::mismatch(a.begin(), a.end(), b.begin(), b.end()); });
+		reading2("lexicographical_compare",
+			[](auto& a, auto& b) { return stl2::lexicographical_compare(a, b); },
+			[](auto& a, auto& b) {
+				return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+			});
+		reading2("is_permutation",
+			[](auto& a, auto& b) { return stl2::is_permutation(a, b); },
+			[](auto& a, auto& b) { return std::is_permutation(a.begin(), a.end(), b.begin(), b.end()); });
+	}
+
+	void register_sorted_searches() {
+		searching("lower_bound",
+			[](auto& v, int k) { return stl2::lower_bound(v, k) - v.begin(); },
+			[](auto& v, int k) { return std::lower_bound(v.begin(), v.end(), k) - v.begin(); });
+		searching("upper_bound",
+			[](auto& v, int k) { return stl2::upper_bound(v, k) - v.begin(); },
+			[](auto& v, int k) { return std::upper_bound(v.begin(), v.end(), k) - v.begin(); });
+		searching("equal_range",
+			[](auto& v, int k) { auto r = stl2::equal_range(v, k); return r.end() - r.begin(); },
+			[](auto& v, int k) { auto r = std::equal_range(v.begin(), v.end(), k); return r.second - r.first; });
+		searching("binary_search",
+			[](auto& v, int k) { return std::ptrdiff_t{stl2::binary_search(v, k)}; },
+			[](auto& v, int k) { return std::ptrdiff_t{std::binary_search(v.begin(), v.end(), k)}; });
+		reading_sorted("partition_point",
+			[](auto& v) { auto const m = static_cast<int>(v.size() / 2); return stl2::partition_point(v, [=](int i) { return i < m; }); },
+			[](auto& v) {
+				auto const m = static_cast<int>(v.size() / 2);
+				return std::partition_point(v.begin(), v.end(), [=](int i) { return i < m; });
+			});
+		reading_sorted("includes",
+			[](auto& v) { return stl2::includes(v, v); },
+			[](auto& v) { return std::includes(v.begin(), v.end(), v.begin(), v.end()); });
+	}
+
+	void register_copying() {
+		copying("copy",
+			[](auto& v, auto& out) { return stl2::copy(v, out.begin()); },
+			[](auto& v, auto& out) { return std::copy(v.begin(), v.end(), out.begin()); });
+		copying("copy_n",
+			[](auto& v, auto& out) { return stl2::copy_n(v.begin(), v.size(), out.begin()); },
+			[](auto& v, auto& out) { return std::copy_n(v.begin(), v.size(), out.begin()); });
+		copying("copy_if",
+			[](auto& v, auto& out) { return stl2::copy_if(v, out.begin(), odd); },
+			[](auto& v, auto& out) { return std::copy_if(v.begin(), v.end(), out.begin(), odd); });
+		copying("copy_backward",
+			[](auto& v, auto& out) { return stl2::copy_backward(v, out.end()); },
+			[](auto& v, auto& out) { return std::copy_backward(v.begin(), v.end(), out.end()); });
+		copying("move",
+			[](auto& v, auto& out) { return stl2::move(v, out.begin()); },
+			[](auto& v, auto& out) { return std::move(v.begin(), v.end(), out.begin()); });
+		copying("move_backward",
+			[](auto& v, auto& out) { return stl2::move_backward(v, out.end()); },
+			[](auto& v, auto& out) { return std::move_backward(v.begin(), v.end(), out.end()); });
+		copying("remove_copy",
+			[](auto& v, auto& out) { return stl2::remove_copy(v, out.begin(), 1); },
+			[](auto& v, auto& out) { return std::remove_copy(v.begin(), v.end(), out.begin(), 1); });
+		copying("remove_copy_if",
+			[](auto& v, auto& out) { return stl2::remove_copy_if(v, out.begin(), odd); },
+			[](auto& v, auto& out) { return std::remove_copy_if(v.begin(), v.end(), out.begin(), odd); });
+		copying("replace_copy",
+			[](auto& v, auto& out) { return stl2::replace_copy(v, out.begin(), 1, 2); },
+			[](auto& v, auto& out) { return std::replace_copy(v.begin(), v.end(), out.begin(), 1, 2); });
+		copying("replace_copy_if",
+			[](auto& v, auto& out) { return stl2::replace_copy_if(v, out.begin(), odd, 0); },
+			[](auto& v, auto& out) { return std::replace_copy_if(v.begin(), v.end(), out.begin(), odd, 0); });
+		copying("reverse_copy",
+			[](auto& v, auto& out) { return stl2::reverse_copy(v, out.begin()); },
+			[](auto& v, auto& out) { return std::reverse_copy(v.begin(), v.end(), out.begin()); });
+		copying("rotate_copy",
+			[](auto& v, auto& out) { return stl2::rotate_copy(v, v.begin() + v.size() / 3, out.begin()); },
+			[](auto& v, auto& out) {
+				return std::rotate_copy(v.begin(), v.begin() + v.size() / 3, v.end(), out.begin());
+			});
+		copying("unique_copy",
+			[](auto& v, auto& out) { return stl2::unique_copy(v, out.begin()); },
+			[](auto& v, auto& out) { return std::unique_copy(v.begin(), v.end(), out.begin()); });
+		copying("partition_copy",
+			[](auto& v, auto& out) {
+				return stl2::partition_copy(v, out.begin(), out.begin() + v.size(), odd);
+			},
+			[](auto& v, auto& out) {
+				return std::partition_copy(v.begin(), v.end(), out.begin(), out.begin() + v.size(), odd);
+			});
+		copying("transform",
+			[](auto& v, auto& out) { return stl2::transform(v, out.begin(), twice); },
+			[](auto& v, auto& out) { return std::transform(v.begin(), v.end(), out.begin(), twice); });
+		copying("transform_binary",
+			[](auto& v, auto& out) { return stl2::transform(v, v, out.begin(), std::plus<>{}); },
+			[](auto& v, auto& out) {
+				return std::transform(v.begin(), v.end(), v.begin(), out.begin(), std::plus<>{});
+			});
+		copying("partial_sort_copy",
+			[](auto& v, auto& out) {
+				return stl2::partial_sort_copy(v, stl2::subrange{out.begin(), out.begin() + v.size() / 10});
+			},
+			[](auto& v, auto& out) {
+				return std::partial_sort_copy(v.begin(), v.end(), out.begin(), out.begin() + v.size() / 10);
+			});
+
+		merging("merge",
+			[](auto& a, auto& b, auto& out) { return stl2::merge(a, b, out.begin()); },
+			[](auto& a, auto& b, auto& out) {
+				return std::merge(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+			});
+		merging("set_union",
+			[](auto& a, auto& b, auto& out) { return stl2::set_union(a, b, out.begin()); },
+			[](auto& a, auto& b, auto& out) {
+				return std::set_union(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+			});
+		merging("set_intersection",
+			[](auto& a, auto& b, auto& out) { return stl2::set_intersection(a, b, out.begin()); },
+			[](auto& a, auto& b, auto& out) {
+				return std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+			});
+		merging("set_difference",
+			[](auto& a, auto& b, auto& out) { return stl2::set_difference(a, b, out.begin()); },
+			[](auto& a, auto& b, auto& out) {
+				return std::set_difference(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+			});
+		merging("set_symmetric_difference",
+			[](auto& a, auto& b, auto& out) { return stl2::set_symmetric_difference(a, b, out.begin()); },
+			[](auto& a, auto& b, auto& out) {
+				return std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+			});
+	}
+
+	void register_modifying() {
+		repeatable("fill",
+			[](auto& v) { return stl2::fill(v, 7); },
+			[](auto& v) { std::fill(v.begin(), v.end(), 7); return v.end(); });
+		repeatable("fill_n",
+			[](auto& v) { return stl2::fill_n(v.begin(), v.size(), 7); },
+			[](auto& v) { return std::fill_n(v.begin(), v.size(), 7); });
+		repeatable("generate",
+			[](auto& v) { int i = 0; return stl2::generate(v, [&]{ return i++; }); },
+			[](auto& v) { int i = 0; std::generate(v.begin(), v.end(), [&]{ return i++; }); return v.end(); });
+		repeatable("generate_n",
+			[](auto& v) { int i = 0; return stl2::generate_n(v.begin(), v.size(), [&]{ return i++; }); },
+			[](auto& v) { int i = 0; return std::generate_n(v.begin(), v.size(), [&]{ return i++; }); });
+		repeatable("swap_ranges",
+			[](auto& v) { auto const h = v.size() / 2; return stl2::swap_ranges(v.begin(), v.begin() + h, v.begin() + h, v.end()); },
+			[](auto& v) { auto const h = v.size() / 2; return std::swap_ranges(v.begin(), v.begin() + h, v.begin() + h); });
+		repeatable("reverse",
+			[](auto& v) { return stl2::reverse(v); },
+			[](auto& v) { std::reverse(v.begin(), v.end()); return v.end(); });
+		repeatable("rotate",
+			[](auto& v) { return stl2::rotate(v, v.begin() + v.size() / 3); },
+			[](auto& v) { return std::rotate(v.begin(), v.begin() + v.size() / 3, v.end()); });
+		repeatable("shuffle",
+			[gen = std::mt19937{1}](auto& v) mutable { return stl2::shuffle(v, gen); },
+			[gen = std::mt19937{1}](auto& v) mutable { std::shuffle(v.begin(), v.end(), gen); return v.end(); });
+		bench::add("algorithm", "shuffle_par", [](bench::context& ctx) {
+			auto v = ctx.generate<int>();
+			std::mt19937_64 gen{1};
+			ctx.run("stl2_par", [&]{ return stl2::shuffle(stl2::ext::execution::par, v, gen); });
+			ctx.run("stl2", [&]{ return stl2::shuffle(v, gen); });
+			ctx.run("std", [&]{ std::shuffle(v.begin(), v.end(), gen); return v.end(); });
+		});
+		sampling<true>("sample");
+		sampling<false>("sample_streaming");
+		repeatable("next_permutation",
+			[](auto& v) { return stl2::next_permutation(v); },
+			[](auto& v) { return std::next_permutation(v.begin(), v.end()); });
+		repeatable("prev_permutation",
+			[](auto& v) { return stl2::prev_permutation(v); },
+			[](auto& v) { return std::prev_permutation(v.begin(), v.end()); });
+
+		mutating("replace",
+			[](auto& v) { return stl2::replace(v, 1, 2); },
+			[](auto& v) { std::replace(v.begin(), v.end(), 1, 2); return v.end(); });
+		mutating("replace_if",
+			[](auto& v) { return stl2::replace_if(v, odd, 0); },
+			[](auto& v) { std::replace_if(v.begin(), v.end(), odd, 0); return v.end(); });
+		mutating("remove",
+			[](auto& v) { return stl2::remove(v, 1); },
+			[](auto& v) { return std::remove(v.begin(), v.end(), 1); });
+		mutating("remove_if",
+			[](auto& v) { return stl2::remove_if(v, odd); },
+			[](auto& v) { return std::remove_if(v.begin(), v.end(), odd); });
+		mutating("unique",
+			[](auto& v) { return stl2::unique(v); },
+			[](auto& v) { return std::unique(v.begin(), v.end()); });
+		mutating("partition",
+			[](auto& v) { return stl2::partition(v, odd); },
+			[](auto& v) { return std::partition(v.begin(), v.end(), odd); });
+		mutating("stable_partition",
+			[](auto& v) { return stl2::stable_partition(v, odd); },
+			[](auto& v) { return std::stable_partition(v.begin(), v.end(), odd); });
+		mutating("sort",
+			[](auto& v) { return stl2::sort(v); },
+			[](auto& v) { std::sort(v.begin(), v.end()); return v.end(); });
+		mutating("stable_sort",
+			[](auto& v) { return stl2::stable_sort(v); },
+			[](auto& v) { std::stable_sort(v.begin(), v.end()); return v.end(); });
+		mutating("radix_sort",
+			[](auto& v) { return stl2::ext::radix_sort(v); },
+			[](auto& v) { std::sort(v.begin(), v.end()); return v.end(); });
+		mutating("partial_sort",
+			[](auto& v) { return stl2::partial_sort(v, v.begin() + v.size() / 10); },
+			[](auto& v) { std::partial_sort(v.begin(), v.begin() + v.size() / 10, v.end()); return v.end(); });
+		mutating("nth_element",
+			[](auto& v) { return stl2::nth_element(v, v.begin() + v.size() / 2); },
+			[](auto& v) { std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end()); return v.end(); });
+		mutating("inplace_merge",
+			[](auto& v) { return stl2::inplace_merge(v, v.begin() + v.size() / 2); },
+			[](auto& v) { std::inplace_merge(v.begin(), v.begin() + v.size() / 2, v.end()); return v.end(); },
+			sort_halves);
+		mutating("make_heap",
+			[](auto& v) { return stl2::make_heap(v); },
+			[](auto& v) { std::make_heap(v.begin(), v.end()); return v.end(); });
+		mutating("push_heap",
+			[](auto& v) {
+				for (auto i = v.begin(); i != v.end();) {
+					stl2::push_heap(v.begin(), ++i);
+				}
+				return v.end();
+			},
+			[](auto& v) {
+				for (auto i = v.begin(); i != v.end();) {
+					std::push_heap(v.begin(), ++i);
+				}
+				return v.end();
+			});
+		mutating("pop_heap",
+			[](auto& v) {
+				for (auto i = v.end(); i != v.begin(); --i) {
+					stl2::pop_heap(v.begin(), i);
+				}
+				return v.end();
+			},
+			[](auto& v) {
+				for (auto i = v.end(); i != v.begin(); --i) {
+					std::pop_heap(v.begin(), i);
+				}
+				return v.end();
+			},
+			heap_data);
+		mutating("sort_heap",
+			[](auto& v) { return stl2::sort_heap(v); },
+			[](auto& v) { std::sort_heap(v.begin(), v.end()); return v.end(); },
+			heap_data);
+	}
+}
+
+int main(int argc, char** argv) {
+	register_non_modifying();
+	register_sorted_searches();
+	register_copying();
+	register_modifying();
+	return bench::main(argc, argv);
+}
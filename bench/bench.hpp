@@ -0,0 +1,435 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_BENCH_BENCH_HPP
+#define STL2_BENCH_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+// A minimal benchmark harness.
+//
+// A benchmark is a function that, given an input size and distribution,
+// builds its data and then times one or more implementations of the same
+// operation with context::run. The first implementation is the subject;
+// each later one is a baseline it is compared against:
+//
+//   bench::add("algorithm", "sort", [](bench::context& ctx) {
+//       auto const data = ctx.generate<int>();
+//       std::vector<int> v;
+//       ctx.reset([&]{ v = data; });
+//       ctx.run("stl2", [&]{ stl2::sort(v); });
+//       ctx.run("std", [&]{ std::sort(v.begin(), v.end()); });
+//   });
+//
+// Each benchmark program registers its benchmarks and then calls
+// bench::main. Results go to stdout (or --out=FILE) as a single JSON
+// document.
+//
+namespace bench {
+	enum class distribution {
+		random, sorted, reversed, organ_pipe, few_unique, all_equal
+	};
+
+	inline const char* to_string(distribution d) noexcept {
+		switch (d) {
+		case distribution::random: return "random";
+		case distribution::sorted: return "sorted";
+		case distribution::reversed: return "reversed";
+		case distribution::organ_pipe: return "organ_pipe";
+		case distribution::few_unique: return "few_unique";
+		case distribution::all_equal: return "all_equal";
+		}
+		return "?";
+	}
+
+	inline bool from_string(const std::string& s, distribution& d) noexcept {
+		for (auto x : {distribution::random, distribution::sorted, distribution::reversed,
+			distribution::organ_pipe, distribution::few_unique, distribution::all_equal})
+		{
+			if (s == to_string(x)) {
+				d = x;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Keeps the compiler from discarding v or the computation of it.
+	template<class T>
+	inline void do_not_optimize(const T& v) {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(v) : "memory");
+#else
+		static volatile const void* sink;
+		sink = std::addressof(v);
+#endif
+	}
+
+	struct result {
+		std::string group, name, impl;
+		std::ptrdiff_t size;
+		distribution dist;
+		std::int64_t iterations;
+		double ns_per_iteration;
+	};
+
+	struct options {
+		std::vector<std::ptrdiff_t> sizes = {1000, 100000};
+		std::vector<distribution> distributions = {distribution::random};
+		double min_time = 0.05; // seconds per repetition
+		int repetitions = 3;
+		std::string filter;
+		std::string out;
+		std::uint64_t seed = 0x5eed;
+	};
+
+	class context {
+		using clock = std::chrono::steady_clock;
+
+		const options& opts_;
+		std::string group_, name_;
+		std::ptrdiff_t size_;
+		distribution dist_;
+		std::function<void()> reset_;
+		std::vector<result>& results_;
+
+		// Returns the nanoseconds taken by n calls of f, with reset_ (if
+		// any) run untimed before each call.
+		template<class F>
+		double time(F& f, std::int64_t n) {
+			using std::chrono::duration;
+			if (!reset_) {
+				auto const start = clock::now();
+				for (std::int64_t i = 0; i < n; ++i) {
+					call(f);
+				}
+				return duration<double, std::nano>(clock::now() - start).count();
+			}
+			double ns = 0;
+			for (std::int64_t i = 0; i < n; ++i) {
+				reset_();
+				auto const start = clock::now();
+				call(f);
+				ns += duration<double, std::nano>(clock::now() - start).count();
+			}
+			return ns;
+		}
+
+		template<class F>
+		static void call(F& f) {
+			if constexpr (std::is_void<decltype(f())>::value) {
+				f();
+				bench::do_not_optimize(f);
+			} else {
+				bench::do_not_optimize(f());
+			}
+		}
+
+	public:
+		context(const options& opts, std::string group, std::string name,
+			std::ptrdiff_t size, distribution dist, std::vector<result>& results)
+		: opts_(opts), group_(std::move(group)), name_(std::move(name))
+		, size_(size), dist_(dist), results_(results)
+		{}
+
+		std::ptrdiff_t size() const noexcept { return size_; }
+		distribution dist() const noexcept { return dist_; }
+
+		// size() values of type T arranged per dist(). Values lie in
+		// [0, size()), or fewer distinct values for few_unique.
+		template<class T>
+		std::vector<T> generate() const {
+			return generate<T>(size_);
+		}
+		template<class T>
+		std::vector<T> generate(std::ptrdiff_t n) const {
+			std::mt19937_64 gen{opts_.seed};
+			std::vector<T> v(static_cast<std::size_t>(n));
+			if (n == 0) {
+				return v;
+			}
+			auto const value = [](std::ptrdiff_t i) { return static_cast<T>(i); };
+			switch (dist_) {
+			case distribution::random:
+				for (auto& x : v) {
+					x = value(static_cast<std::ptrdiff_t>(gen() % static_cast<std::uint64_t>(n)));
+				}
+				break;
+			case distribution::sorted:
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					v[i] = value(i);
+				}
+				break;
+			case distribution::reversed:
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					v[i] = value(n - 1 - i);
+				}
+				break;
+			case distribution::organ_pipe:
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					v[i] = value(i < n / 2 ? i : n - 1 - i);
+				}
+				break;
+			case distribution::few_unique:
+				for (auto& x : v) {
+					x = value(static_cast<std::ptrdiff_t>(gen() % 16));
+				}
+				break;
+			case distribution::all_equal:
+				std::fill(v.begin(), v.end(), value(0));
+				break;
+			}
+			return v;
+		}
+
+		// f runs before every timed call of the following run()s, for
+		// operations that consume or mutate their input.
+		template<class F>
+		void reset(F f) {
+			reset_ = std::move(f);
+		}
+
+		// Times f, which performs the operation once, and records the
+		// best of the configured repetitions.
+		template<class F>
+		void run(const char* impl, F f) {
+			// Grow the batch until it takes long enough to time reliably.
+			std::int64_t n = 1;
+			double ns = time(f, n);
+			auto const target = opts_.min_time * 1e9;
+			while (ns < target && n < (std::int64_t{1} << 40)) {
+				auto const scale = ns > 0 ? std::min(10.0, 1.4 * target / ns) : 10.0;
+				n = std::max(n + 1, static_cast<std::int64_t>(n * scale));
+				ns = time(f, n);
+			}
+			double best = ns / n;
+			for (int i = 1; i < opts_.repetitions; ++i) {
+				best = std::min(best, time(f, n) / n);
+			}
+			results_.push_back({group_, name_, impl, size_, dist_, n, best});
+		}
+	};
+
+	struct benchmark {
+		std::string group, name;
+		std::function<void(context&)> fn;
+	};
+
+	inline std::vector<benchmark>& registry() {
+		static std::vector<benchmark> r;
+		return r;
+	}
+
+	template<class F>
+	void add(std::string group, std::string name, F fn) {
+		registry().push_back({std::move(group), std::move(name), std::move(fn)});
+	}
+
+	namespace detail {
+		inline void write_string(std::FILE* f, const std::string& s) {
+			std::fputc('"', f);
+			for (char c : s) {
+				if (c == '"' || c == '\\') {
+					std::fputc('\\', f);
+				}
+				std::fputc(c, f);
+			}
+			std::fputc('"', f);
+		}
+
+		inline void write_json(std::FILE* f, const options& opts,
+			const std::vector<result>& results)
+		{
+			std::fprintf(f, "{\n  \"context\": {\n");
+			std::fprintf(f, "    \"date\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+#if defined(__VERSION__)
+			std::fprintf(f, "    \"compiler\": ");
+			write_string(f, __VERSION__);
+			std::fprintf(f, ",\n");
+#endif
+#if defined(NDEBUG)
+			std::fprintf(f, "    \"assertions\": false,\n");
+#else
+			std::fprintf(f, "    \"assertions\": true,\n");
+#endif
+			std::fprintf(f, "    \"hardware_concurrency\": %u,\n",
+				std::thread::hardware_concurrency());
+			std::fprintf(f, "    \"min_time\": %g,\n    \"repetitions\": %d\n  },\n",
+				opts.min_time, opts.repetitions);
+
+			std::fprintf(f, "  \"benchmarks\": [");
+			for (std::size_t i = 0; i < results.size(); ++i) {
+				auto const& r = results[i];
+				std::fprintf(f, "%s\n    {\"group\": ", i ? "," : "");
+				write_string(f, r.group);
+				std::fprintf(f, ", \"name\": ");
+				write_string(f, r.name);
+				std::fprintf(f, ", \"impl\": ");
+				write_string(f, r.impl);
+				std::fprintf(f, ", \"size\": %td, \"distribution\": \"%s\", "
+					"\"iterations\": %lld, \"ns_per_iteration\": %.3f, \"ns_per_element\": %.5f}",
+					r.size, to_string(r.dist), static_cast<long long>(r.iterations),
+					r.ns_per_iteration, r.size > 0 ? r.ns_per_iteration / r.size : 0.0);
+			}
+			std::fprintf(f, "\n  ],\n");
+
+			// Each run's subject against each of its baselines.
+			std::fprintf(f, "  \"comparisons\": [");
+			bool first = true;
+			for (std::size_t i = 0; i < results.size();) {
+				auto j = i + 1;
+				for (; j < results.size() && results[j].group == results[i].group &&
+					results[j].name == results[i].name && results[j].size == results[i].size &&
+					results[j].dist == results[i].dist; ++j)
+				{
+					auto const& s = results[i];
+					auto const& b = results[j];
+					std::fprintf(f, "%s\n    {\"group\": ", first ? "" : ",");
+					first = false;
+					write_string(f, s.group);
+					std::fprintf(f, ", \"name\": ");
+					write_string(f, s.name);
+					std::fprintf(f, ", \"size\": %td, \"distribution\": \"%s\", \"subject\": ",
+						s.size, to_string(s.dist));
+					write_string(f, s.impl);
+					std::fprintf(f, ", \"baseline\": ");
+					write_string(f, b.impl);
+					std::fprintf(f, ", \"ratio\": %.4f}",
+						b.ns_per_iteration > 0 ? s.ns_per_iteration / b.ns_per_iteration : 0.0);
+				}
+				i = j;
+			}
+			std::fprintf(f, "\n  ]\n}\n");
+		}
+
+		template<class T, class F>
+		bool parse_list(const char* s, std::vector<T>& out, F parse) {
+			out.clear();
+			std::string item;
+			for (const char* p = s;; ++p) {
+				if (*p == ',' || *p == '\0') {
+					T t;
+					if (!parse(item, t)) {
+						return false;
+					}
+					out.push_back(t);
+					item.clear();
+					if (*p == '\0') {
+						return true;
+					}
+				} else {
+					item += *p;
+				}
+			}
+		}
+
+		inline bool parse_size(const std::string& s, std::ptrdiff_t& n) {
+			char* end;
+			auto const v = std::strtoll(s.c_str(), &end, 10);
+			if (end == s.c_str() || *end != '\0' || v < 0) {
+				return false;
+			}
+			n = static_cast<std::ptrdiff_t>(v);
+			return true;
+		}
+
+		inline const char* option(const char* arg, const char* name) {
+			auto const len = std::strlen(name);
+			return std::strncmp(arg, name, len) == 0 && arg[len] == '=' ? arg + len + 1 : nullptr;
+		}
+
+		inline void usage(const char* argv0) {
+			std::fprintf(stderr,
+				"usage: %s [--sizes=N,...] [--distributions=D,...] [--min-time=SECONDS]\n"
+				"          [--repetitions=N] [--filter=SUBSTRING] [--seed=N] [--out=FILE]\n"
+				"distributions: random sorted reversed organ_pipe few_unique all_equal\n",
+				argv0);
+		}
+	}
+
+	// Runs every registered benchmark whose "group/name" contains the
+	// filter, for each size and distribution.
+	inline int main(int argc, char** argv) {
+		options opts;
+		for (int i = 1; i < argc; ++i) {
+			const char* v;
+			bool ok = true;
+			if ((v = detail::option(argv[i], "--sizes"))) {
+				ok = detail::parse_list(v, opts.sizes, detail::parse_size);
+			} else if ((v = detail::option(argv[i], "--distributions"))) {
+				ok = detail::parse_list(v, opts.distributions,
+					[](const std::string& s, distribution& d) { return from_string(s, d); });
+			} else if ((v = detail::option(argv[i], "--min-time"))) {
+				opts.min_time = std::atof(v);
+				ok = opts.min_time > 0;
+			} else if ((v = detail::option(argv[i], "--repetitions"))) {
+				opts.repetitions = std::atoi(v);
+				ok = opts.repetitions > 0;
+			} else if ((v = detail::option(argv[i], "--filter"))) {
+				opts.filter = v;
+			} else if ((v = detail::option(argv[i], "--seed"))) {
+				opts.seed = std::strtoull(v, nullptr, 10);
+			} else if ((v = detail::option(argv[i], "--out"))) {
+				opts.out = v;
+			} else {
+				ok = false;
+			}
+			if (!ok) {
+				detail::usage(argv[0]);
+				return 2;
+			}
+		}
+
+		std::vector<result> results;
+		for (auto const& b : registry()) {
+			if (!opts.filter.empty() &&
+				(b.group + "/" + b.name).find(opts.filter) == std::string::npos)
+			{
+				continue;
+			}
+			for (auto const n : opts.sizes) {
+				for (auto const d : opts.distributions) {
+					context ctx{opts, b.group, b.name, n, d, results};
+					b.fn(ctx);
+				}
+			}
+		}
+
+		std::FILE* f = stdout;
+		if (!opts.out.empty() && !(f = std::fopen(opts.out.c_str(), "w"))) {
+			std::perror(opts.out.c_str());
+			return 1;
+		}
+		detail::write_json(f, opts, results);
+		if (f != stdout) {
+			std::fclose(f);
+		}
+		return 0;
+	}
+}
+
+#endif
@@ -0,0 +1,147 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Reading and writing streams through iterators and views.
+//
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/view/istream.hpp>
+#include <stl2/view/istreambuf.hpp>
+#include <stl2/view/mapped_file.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "bench.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	// size() characters of text, about one in eight a newline.
+	std::string text(bench::context& ctx) {
+		std::string s;
+		for (int i : ctx.generate<int>()) {
+			s += i % 8 == 0 ? '\n' : static_cast<char>('a' + i % 26);
+		}
+		return s;
+	}
+
+	void count_lines(bench::context& ctx) {
+		auto const s = text(ctx);
+		char path[] = "/tmp/stl2_bench_XXXXXX";
+		::close(::mkstemp(path));
+		std::ofstream{path, std::ios::binary} << s;
+		ctx.run("mapped_file", [&]{
+			return stl2::count(stl2::view::mapped_file(path), '\n');
+		});
+		ctx.run("istreambuf_view", [&]{
+			std::istringstream sin{s};
+			return stl2::count(stl2::view::istreambuf(sin), '\n');
+		});
+		ctx.run("istreambuf_iterator", [&]{
+			std::istringstream sin{s};
+			return stl2::count(stl2::istreambuf_iterator<char>{sin},
+				stl2::default_sentinel{}, '\n');
+		});
+		std::remove(path);
+	}
+
+	void copy_chars(bench::context& ctx) {
+		auto const s = text(ctx);
+		std::string out(s.size(), '\0');
+		ctx.run("istreambuf_view", [&]{
+			std::istringstream sin{s};
+			return stl2::copy(stl2::view::istreambuf(sin), out.data()).out() - out.data();
+		});
+		ctx.run("istreambuf_iterator", [&]{
+			std::istringstream sin{s};
+			return stl2::copy(stl2::istreambuf_iterator<char>{sin},
+				stl2::default_sentinel{}, out.data()).out() - out.data();
+		});
+	}
+
+	// size() whitespace-separated integers.
+	template<class T>
+	void parse(bench::context& ctx) {
+		std::ostringstream os;
+		for (int i : ctx.generate<int>()) {
+			os << static_cast<T>(i) / 8 << ' ';
+		}
+		auto const s = os.str();
+		ctx.run("istream_view", [&]{
+			std::istringstream sin{s};
+			T sum = 0;
+			for (T x : stl2::ext::istream_view<T>{sin}) {
+				sum += x;
+			}
+			return sum;
+		});
+		ctx.run("operator>>", [&]{
+			std::istringstream sin{s};
+			T sum = 0;
+			for (T x; sin >> x;) {
+				sum += x;
+			}
+			return sum;
+		});
+	}
+
+	void write_chars(bench::context& ctx) {
+		auto const s = text(ctx);
+		ctx.run("ostreambuf_iterator", [&]{
+			std::ostringstream os;
+			stl2::copy(s, stl2::ostreambuf_iterator<char>{os});
+			return os.tellp();
+		});
+		ctx.run("sputc", [&]{
+			std::ostringstream os;
+			auto out = stl2::ostreambuf_iterator<char>{os};
+			for (char c : s) {
+				*out++ = c;
+			}
+			return os.tellp();
+		});
+	}
+
+	// size() comma-separated values.
+	template<class T>
+	void write_csv(bench::context& ctx) {
+		std::vector<T> v;
+		for (int i : ctx.generate<int>()) {
+			v.push_back(static_cast<T>(i) / 8);
+		}
+		ctx.run("buffered_ostream_iterator", [&]{
+			std::ostringstream os;
+			stl2::copy(v, stl2::ext::buffered_ostream_iterator<T>{os, ","});
+			return os.tellp();
+		});
+		ctx.run("ostream_iterator", [&]{
+			std::ostringstream os;
+			stl2::copy(v, stl2::ostream_iterator<T>{os, ","});
+			return os.tellp();
+		});
+	}
+}
+
+int main(int argc, char** argv) {
+	bench::add("iostream", "count_lines", count_lines);
+	bench::add("iostream", "copy_chars", copy_chars);
+	bench::add("iostream", "parse_int", parse<int>);
+	bench::add("iostream", "parse_double", parse<double>);
+	bench::add("iostream", "write_chars", write_chars);
+	bench::add("iostream", "write_int", write_csv<int>);
+	bench::add("iostream", "write_double", write_csv<double>);
+	return bench::main(argc, argv);
+}
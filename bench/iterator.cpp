@@ -0,0 +1,80 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Iterator adaptors against a loop over the underlying pointer.
+//
+#include <stl2/iterator.hpp>
+#include <vector>
+#include "bench.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	// The sum of [first, last).
+	template<class I, class S>
+	long sum(I first, S last) {
+		long s = 0;
+		for (; first != last; ++first) {
+			s += *first;
+		}
+		return s;
+	}
+
+	template<class F>
+	void adaptor(const char* name, F f) {
+		bench::add("iterator", name, [=](bench::context& ctx) {
+			auto const v = ctx.generate<int>();
+			const int* const first = v.data();
+			const int* const last = first + v.size();
+			ctx.run("stl2", [&]{ return f(first, last); });
+			ctx.run("pointer", [&]{ return sum(first, last); });
+		});
+	}
+
+	// A sentinel with state, which common_iterator can't fold away.
+	struct bound {
+		const int* last;
+
+		friend bool operator==(const int* i, bound b) noexcept { return i == b.last; }
+		friend bool operator==(bound b, const int* i) noexcept { return i == b.last; }
+		friend bool operator!=(const int* i, bound b) noexcept { return i != b.last; }
+		friend bool operator!=(bound b, const int* i) noexcept { return i != b.last; }
+	};
+}
+
+int main(int argc, char** argv) {
+	adaptor("counted_iterator", [](const int* first, const int* last) {
+		return sum(stl2::make_counted_iterator(first, last - first), stl2::default_sentinel{});
+	});
+	adaptor("common_iterator", [](const int* first, const int* last) {
+		using C = stl2::common_iterator<stl2::counted_iterator<const int*>, stl2::default_sentinel>;
+		return sum(C{stl2::make_counted_iterator(first, last - first)}, C{stl2::default_sentinel{}});
+	});
+	adaptor("common_iterator_bound", [](const int* first, const int* last) {
+		using C = stl2::common_iterator<const int*, bound>;
+		return sum(C{first}, C{bound{last}});
+	});
+	adaptor("move_iterator", [](const int* first, const int* last) {
+		return sum(stl2::make_move_iterator(first), stl2::make_move_iterator(last));
+	});
+	adaptor("reverse_iterator", [](const int* first, const int* last) {
+		return sum(stl2::make_reverse_iterator(last), stl2::make_reverse_iterator(first));
+	});
+	adaptor("any_input_iterator", [](const int* first, const int* last) {
+		using AI = stl2::any_input_iterator<const int&>;
+		return sum(AI{first}, AI{last});
+	});
+	adaptor("any_input_iterator_counted", [](const int* first, const int* last) {
+		using AI = stl2::ext::basic_any_bounded_input_iterator<const int&, 16, false>;
+		return sum(AI{stl2::make_counted_iterator(first, last - first)}, stl2::default_sentinel{});
+	});
+	return bench::main(argc, argv);
+}
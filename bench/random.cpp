@@ -0,0 +1,100 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Random engines, and bounded random integer generation.
+//
+#include <stl2/random.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <cstdint>
+#include <random>
+#include "bench.hpp"
+
+namespace rnd = __stl2::detail::random;
+
+namespace {
+	template<class G>
+	std::uint64_t draw(G& g, std::ptrdiff_t n) {
+		std::uint64_t sum = 0;
+		for (std::ptrdiff_t i = 0; i < n; ++i) {
+			sum += g();
+		}
+		return sum;
+	}
+
+	// size() outputs of each engine.
+	void engine(bench::context& ctx) {
+		auto const n = ctx.size();
+		__stl2::ext::xoshiro256starstar xoshiro{1};
+		__stl2::ext::splitmix64 splitmix{1};
+		std::mt19937_64 mt{1};
+		ctx.run("xoshiro256starstar", [&]{ return draw(xoshiro, n); });
+#ifdef __SIZEOF_INT128__
+		__stl2::ext::pcg64 pcg{1};
+		ctx.run("pcg64", [&]{ return draw(pcg, n); });
+#endif
+		ctx.run("splitmix64", [&]{ return draw(splitmix, n); });
+		ctx.run("mt19937_64", [&]{ return draw(mt, n); });
+	}
+
+	// Seeding an engine from fresh entropy and taking one output, as a
+	// new thread's first shuffle does.
+	void seed(bench::context& ctx) {
+		ctx.run("xoshiro256starstar", [&]{
+			auto q = rnd::entropy();
+			return __stl2::ext::xoshiro256starstar{q}();
+		});
+		ctx.run("mt19937_64", [&]{
+			auto q = rnd::entropy();
+			return std::mt19937_64{q}();
+		});
+	}
+
+	// size() draws from [0, i + 1) for each i, as a Fisher-Yates shuffle
+	// makes them.
+	void bounded(bench::context& ctx) {
+		auto const n = static_cast<std::uint64_t>(ctx.size());
+		std::mt19937_64 gen{1};
+		ctx.run("bounded2", [&]{
+			std::uint64_t sum = 0, i = 1;
+			for (; i + 1 < n; i += 2) {
+				auto const [a, b] = rnd::bounded2(gen, i, i + 1);
+				sum += a + b;
+			}
+			for (; i < n; ++i) {
+				sum += rnd::bounded(gen, i);
+			}
+			return sum;
+		});
+		ctx.run("bounded", [&]{
+			std::uint64_t sum = 0;
+			for (std::uint64_t i = 1; i < n; ++i) {
+				sum += rnd::bounded(gen, i);
+			}
+			return sum;
+		});
+		ctx.run("std", [&]{
+			std::uniform_int_distribution<std::uint64_t> dist;
+			using param_t = std::uniform_int_distribution<std::uint64_t>::param_type;
+			std::uint64_t sum = 0;
+			for (std::uint64_t i = 1; i < n; ++i) {
+				sum += dist(gen, param_t{0, i - 1});
+			}
+			return sum;
+		});
+	}
+}
+
+int main(int argc, char** argv) {
+	bench::add("random", "engine", engine);
+	bench::add("random", "seed", seed);
+	bench::add("random", "bounded", bounded);
+	return bench::main(argc, argv);
+}
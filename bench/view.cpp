@@ -0,0 +1,380 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// View pipelines against the loops they abstract.
+//
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/for_each.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
+#include <stl2/view/any.hpp>
+#include <stl2/view/cache1.hpp>
+#include <stl2/view/chunk.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/join.hpp>
+#include <stl2/view/split.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/transform.hpp>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+namespace stl2 = __stl2;
+namespace view = __stl2::view;
+
+namespace {
+	constexpr auto even = [](int i) { return (i & 1) == 0; };
+	constexpr auto square = [](int i) { return i * i; };
+
+	// The abstraction penalty of single views, and of an iota pipeline,
+	// over the loops they stand for.
+	void transform(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : v | view::transform(square)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (int i : v) {
+				sum += square(i);
+			}
+			return sum;
+		});
+	}
+
+	void filter(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : v | view::filter(even)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (int i : v) {
+				if (even(i)) {
+					sum += i;
+				}
+			}
+			return sum;
+		});
+	}
+
+	void take(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		auto const n = static_cast<std::ptrdiff_t>(ctx.size() / 2);
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : v | view::take(n)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (auto i = v.begin(), e = v.begin() + n; i != e; ++i) {
+				sum += *i;
+			}
+			return sum;
+		});
+	}
+
+	void iota(bench::context& ctx) {
+		auto const n = static_cast<int>(ctx.size());
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : view::iota(0, n)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (int i = 0; i != n; ++i) {
+				sum += i;
+			}
+			return sum;
+		});
+	}
+
+	void iota_filter_transform_take(bench::context& ctx) {
+		auto const n = static_cast<int>(ctx.size());
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : view::iota(0) | view::filter(even) | view::transform(square) | view::take(n)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			int taken = 0;
+			for (int i = 0; taken != n; ++i) {
+				if (even(i)) {
+					sum += square(i);
+					++taken;
+				}
+			}
+			return sum;
+		});
+	}
+
+	void filter_transform_take(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		auto const n = ctx.size() / 4;
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : v | view::filter(even) | view::transform(square) | view::take(n)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("for_each_while", [&]{
+			long sum = 0;
+			stl2::ext::for_each_while(
+				v | view::filter(even) | view::transform(square) | view::take(n),
+				[&](int i) { sum += i; return true; });
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			std::ptrdiff_t taken = 0;
+			for (auto i = v.begin(); taken < n && i != v.end(); ++i) {
+				if (even(*i)) {
+					sum += square(*i);
+					++taken;
+				}
+			}
+			return sum;
+		});
+	}
+
+	// filter | transform behind ext::any_view, consumed per element and
+	// by the chunked for_each.
+	void any(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		auto const erased = [&]{
+			return stl2::ext::any_view<int>{v | view::filter(even) | view::transform(square)};
+		};
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			stl2::for_each(erased(), [&](int i) { sum += i; });
+			return sum;
+		});
+		ctx.run("per_element", [&]{
+			long sum = 0;
+			for (int i : erased()) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (int i : v) {
+				if (even(i)) {
+					sum += square(i);
+				}
+			}
+			return sum;
+		});
+	}
+
+	void join(bench::context& ctx) {
+		// size() elements in rows of 16.
+		auto const flat = ctx.generate<int>();
+		std::vector<std::vector<int>> rows;
+		for (std::size_t i = 0; i < flat.size(); i += 16) {
+			rows.emplace_back(flat.begin() + i, flat.begin() + std::min(i + 16, flat.size()));
+		}
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : rows | view::join) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("for_each", [&]{
+			long sum = 0;
+			stl2::for_each(rows | view::join, [&](int i) { sum += i; });
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (auto& row : rows) {
+				for (int i : row) {
+					sum += i;
+				}
+			}
+			return sum;
+		});
+	}
+
+	// The sum of the maxima of blocks of 64.
+	void chunk(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (auto block : v | view::ext::chunk(64)) {
+				int m = block[0];
+				for (int i : block) {
+					m = std::max(m, i);
+				}
+				sum += m;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			auto const n = v.size();
+			for (std::size_t b = 0; b < n; b += 64) {
+				auto const e = std::min(b + 64, n);
+				int m = v[b];
+				for (auto i = b; i < e; ++i) {
+					m = std::max(m, v[i]);
+				}
+				sum += m;
+			}
+			return sum;
+		});
+	}
+
+	// A transform too costly to inline, under a filter that reads each
+	// element it accepts twice.
+	[[gnu::noinline]] int mix(int i) {
+		unsigned x = static_cast<unsigned>(i);
+		for (int n = 0; n < 16; ++n) {
+			x = (x ^ (x >> 15)) * 0x2c1b3c6dU;
+		}
+		return static_cast<int>(x >> 1);
+	}
+
+	void transform_filter(bench::context& ctx) {
+		auto const v = ctx.generate<int>();
+		ctx.run("stl2", [&]{
+			long sum = 0;
+			for (int i : v | view::transform(mix) | view::filter(even)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("cache1", [&]{
+			long sum = 0;
+			for (int i : v | view::transform(mix) | view::ext::cache1 | view::filter(even)) {
+				sum += i;
+			}
+			return sum;
+		});
+		ctx.run("loop", [&]{
+			long sum = 0;
+			for (int i : v) {
+				int const x = mix(i);
+				if (even(x)) {
+					sum += x;
+				}
+			}
+			return sum;
+		});
+	}
+
+	// size() characters, about one in eight a space.
+	std::string words(bench::context& ctx) {
+		std::string text;
+		for (int i : ctx.generate<int>()) {
+			text += i % 8 == 0 ? ' ' : static_cast<char>('a' + i % 26);
+		}
+		return text;
+	}
+
+	void split(bench::context& ctx) {
+		auto const text = words(ctx);
+		ctx.run("stl2", [&]{
+			std::ptrdiff_t words = 0;
+			long chars = 0;
+			for (auto word : text | view::split(' ')) {
+				++words;
+				for (char c : word) {
+					chars += c;
+				}
+			}
+			return words + chars;
+		});
+		ctx.run("loop", [&]{
+			std::ptrdiff_t words = 0;
+			long chars = 0;
+			auto i = text.begin();
+			auto const last = text.end();
+			if (i != last) {
+				for (;;) {
+					++words;
+					auto const j = std::find(i, last, ' ');
+					for (; i != j; ++i) {
+						chars += *i;
+					}
+					if (j == last) {
+						break;
+					}
+					i = j + 1;
+				}
+			}
+			return words + chars;
+		});
+	}
+
+	// The words with an 'e' in them; count sees each word as one span.
+	void split_count(bench::context& ctx) {
+		auto const text = words(ctx);
+		ctx.run("stl2", [&]{
+			std::ptrdiff_t n = 0;
+			for (auto word : text | view::split(' ')) {
+				n += stl2::count(word, 'e') != 0;
+			}
+			return n;
+		});
+		ctx.run("loop", [&]{
+			std::ptrdiff_t n = 0;
+			auto i = text.begin();
+			auto const last = text.end();
+			if (i != last) {
+				for (;;) {
+					auto const j = std::find(i, last, ' ');
+					n += std::find(i, j, 'e') != j;
+					if (j == last) {
+						break;
+					}
+					i = j + 1;
+				}
+			}
+			return n;
+		});
+	}
+}
+
+int main(int argc, char** argv) {
+	bench::add("view", "transform", transform);
+	bench::add("view", "filter", filter);
+	bench::add("view", "take", take);
+	bench::add("view", "iota", iota);
+	bench::add("view", "iota_filter_transform_take", iota_filter_transform_take);
+	bench::add("view", "filter_transform_take", filter_transform_take);
+	bench::add("view", "any", any);
+	bench::add("view", "join", join);
+	bench::add("view", "chunk", chunk);
+	bench::add("view", "transform_filter", transform_filter);
+	bench::add("view", "split", split);
+	bench::add("view", "split_count", split_count);
+	return bench::main(argc, argv);
+}
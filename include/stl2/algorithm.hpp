@@ -69,6 +69,7 @@
 #include <stl2/detail/algorithm/pop_heap.hpp>
 #include <stl2/detail/algorithm/prev_permutation.hpp>
 #include <stl2/detail/algorithm/push_heap.hpp>
+#include <stl2/detail/algorithm/radix_sort.hpp>
 #include <stl2/detail/algorithm/remove.hpp>
 #include <stl2/detail/algorithm/remove_copy.hpp>
 #include <stl2/detail/algorithm/remove_copy_if.hpp>
@@ -13,8 +13,13 @@
 #define STL2_DETAIL_ALGORITHM_COPY_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
+#include <stl2/detail/iterator/chunked.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // copy [alg.copy]
@@ -26,6 +31,41 @@ STL2_OPEN_NAMESPACE {
 	tagged_pair<tag::in(I), tag::out(O)>
 	copy(I first, S last, O result)
 	{
+		if constexpr (SizedSentinel<S, I> && detail::bitwise::Assignable<I, O>) {
+			auto const n = iter_difference_t<I>(last - first);
+			detail::bitwise::copy_n(first, n, result);
+			return {first + n, result + n};
+		} else if constexpr (detail::segmented::Writable<I, S, O>) {
+			auto const n = iter_difference_t<I>(last - first);
+			if (n > 0) {
+				result.write(ext::to_address(first), n);
+			}
+			return {first + n, std::move(result)};
+		} else if constexpr (detail::segmented::Segmentable<I, S> &&
+			IndirectlyCopyable<const iter_value_t<I>*, O>)
+		{
+			for (auto seg = first.segment(); !seg.empty(); seg = first.segment()) {
+				result = __stl2::copy(seg.data(), seg.data() + seg.size(),
+					std::move(result)).out();
+				first.consume(seg.size());
+			}
+			return {std::move(first), std::move(result)};
+		} else if constexpr (detail::chunked::Chunkable<I, S> &&
+			IndirectlyCopyable<iter_value_t<I>*, O>)
+		{
+			detail::chunked::for_each(first, [&](auto chunk) {
+				result = __stl2::copy(chunk.data(), chunk.data() + chunk.size(),
+					std::move(result)).out();
+			});
+			return {std::move(first), std::move(result)};
+		} else if constexpr (detail::segmented::Hierarchical<I, S>) {
+			first = detail::segmented::for_each_local(first, last,
+				[&](auto lfirst, auto llast) {
+					result = __stl2::copy(std::move(lfirst), std::move(llast),
+						std::move(result)).out();
+				});
+			return {std::move(first), std::move(result)};
+		}
 		for (; first != last; ++first, ++result) {
 			*result = *first;
 		}
@@ -39,7 +79,46 @@ STL2_OPEN_NAMESPACE {
 	tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(__f<O>)>
 	copy(Rng&& rng, O&& result)
 	{
-		return __stl2::copy(__stl2::begin(rng), __stl2::end(rng), std::forward<O>(result));
+		if constexpr (CommonRange<Rng> && detail::InternallyIterable<Rng>) {
+			__f<O> out = std::forward<O>(result);
+			__stl2::ext::for_each_while(rng, [&](auto&& x) -> bool {
+				*out = std::forward<decltype(x)>(x);
+				++out;
+				return true;
+			});
+			return {__stl2::end(rng), std::move(out)};
+		} else {
+			return __stl2::copy(__stl2::begin(rng), __stl2::end(rng), std::forward<O>(result));
+		}
+	}
+
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S, WeaklyIncrementable O>
+	requires
+		IndirectlyCopyable<I, O>
+	tagged_pair<tag::in(I), tag::out(O)>
+	copy(E&&, I first, S last, O result)
+	{
+		if constexpr (detail::Parallelizable<E, I, S> && RandomAccessIterator<O>) {
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+				__stl2::copy(first + lo, first + hi, result + lo);
+			});
+			return {first + n, result + n};
+		} else {
+			return __stl2::copy(std::move(first), std::move(last), std::move(result));
+		}
+	}
+
+	template<ext::ExecutionPolicy E, ForwardRange Rng, class O>
+	requires
+		WeaklyIncrementable<__f<O>> &&
+		IndirectlyCopyable<iterator_t<Rng>, __f<O>>
+	tagged_pair<tag::in(safe_iterator_t<Rng>), tag::out(__f<O>)>
+	copy(E&& exec, Rng&& rng, O&& result)
+	{
+		return __stl2::copy(std::forward<E>(exec),
+			__stl2::begin(rng), __stl2::end(rng), std::forward<O>(result));
 	}
 
 	// Extension: two-range copy
@@ -15,6 +15,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
@@ -30,6 +31,12 @@ STL2_OPEN_NAMESPACE {
 	copy_backward(I1 first, S1 sent, I2 out)
 	{
 		auto last = __stl2::next(first, std::move(sent));
+		if constexpr (detail::bitwise::Assignable<I1, I2>) {
+			auto const n = iter_difference_t<I1>(last - first);
+			out -= n;
+			detail::bitwise::copy_n(first, n, out);
+			return {std::move(last), std::move(out)};
+		}
 		auto i = last;
 		while (i != first) {
 			*--out = *--i;
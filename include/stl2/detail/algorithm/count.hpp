@@ -15,7 +15,11 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/chunked.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // count [alg.count]
@@ -27,6 +31,40 @@ STL2_OPEN_NAMESPACE {
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, const T& value, Proj proj = Proj{}) const
 		{
+			if constexpr (detail::simd::Searchable<I, S, T, Proj>) {
+				auto const n = iter_difference_t<I>(last - first);
+				if (!detail::simd::constant_evaluated(first, n)) {
+					auto const p = detail::simd::data(first, n);
+					return detail::simd::count(p, p + n, value);
+				}
+			} else if constexpr (detail::segmented::Segmentable<I, S> &&
+				IndirectRelation<equal_to<>, projected<const iter_value_t<I>*, Proj>, const T*>)
+			{
+				iter_difference_t<I> n = 0;
+				for (auto seg = first.segment(); !seg.empty(); seg = first.segment()) {
+					n += (*this)(seg.data(), seg.data() + seg.size(),
+						value, std::ref(proj));
+					first.consume(seg.size());
+				}
+				return n;
+			} else if constexpr (detail::chunked::Chunkable<I, S> &&
+				IndirectRelation<equal_to<>, projected<iter_value_t<I>*, Proj>, const T*>)
+			{
+				iter_difference_t<I> n = 0;
+				detail::chunked::for_each(first, [&](auto chunk) {
+					n += (*this)(chunk.data(), chunk.data() + chunk.size(),
+						value, std::ref(proj));
+				});
+				return n;
+			} else if constexpr (detail::segmented::Hierarchical<I, S>) {
+				iter_difference_t<I> n = 0;
+				detail::segmented::for_each_local(first, last,
+					[&](auto lfirst, auto llast) {
+						n += (*this)(std::move(lfirst), std::move(llast),
+							value, std::ref(proj));
+					});
+				return n;
+			}
 			iter_difference_t<I> n = 0;
 			for (; first != last; ++first) {
 				if (__stl2::invoke(proj, *first) == value) {
@@ -41,8 +79,19 @@ STL2_OPEN_NAMESPACE {
 		constexpr iter_difference_t<iterator_t<R>>
 		operator()(R&& r, const T& value, Proj proj = Proj{}) const
 		{
-			return (*this)(__stl2::begin(r), __stl2::end(r),
-				value, std::ref(proj));
+			if constexpr (detail::InternallyIterable<R>) {
+				iter_difference_t<iterator_t<R>> n = 0;
+				__stl2::ext::for_each_while(r, [&](auto&& x) -> bool {
+					if (__stl2::invoke(proj, std::forward<decltype(x)>(x)) == value) {
+						++n;
+					}
+					return true;
+				});
+				return n;
+			} else {
+				return (*this)(__stl2::begin(r), __stl2::end(r),
+					value, std::ref(proj));
+			}
 		}
 	};
 
@@ -16,6 +16,9 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution/parallel.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // count_if [alg.count]
@@ -27,6 +30,14 @@ STL2_OPEN_NAMESPACE {
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, Pred pred, Proj proj = Proj{}) const {
 			auto n = iter_difference_t<I>{0};
+			if constexpr (detail::segmented::Hierarchical<I, S>) {
+				detail::segmented::for_each_local(first, last,
+					[&](auto lfirst, auto llast) {
+						n += (*this)(std::move(lfirst), std::move(llast),
+							std::ref(pred), std::ref(proj));
+					});
+				return n;
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
 					++n;
@@ -39,7 +50,47 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
 		constexpr iter_difference_t<iterator_t<R>>
 		operator()(R&& r, Pred pred, Proj proj = Proj{}) const {
-			return (*this)(__stl2::begin(r), __stl2::end(r),
+			if constexpr (detail::InternallyIterable<R>) {
+				iter_difference_t<iterator_t<R>> n = 0;
+				__stl2::ext::for_each_while(r, [&](auto&& x) -> bool {
+					if (__stl2::invoke(pred, __stl2::invoke(proj, std::forward<decltype(x)>(x)))) {
+						++n;
+					}
+					return true;
+				});
+				return n;
+			} else {
+				return (*this)(__stl2::begin(r), __stl2::end(r),
+					std::ref(pred), std::ref(proj));
+			}
+		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S, class Proj = identity,
+			IndirectUnaryPredicate<projected<I, Proj>> Pred>
+		iter_difference_t<I>
+		operator()(E&&, I first, S last, Pred pred, Proj proj = Proj{}) const {
+			if constexpr (detail::Parallelizable<E, I, S>) {
+				auto const n = static_cast<std::ptrdiff_t>(last - first);
+				if (n == 0) {
+					return 0;
+				}
+				return detail::parallel_reduce<iter_difference_t<I>>(n,
+					[&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+						return (*this)(first + lo, first + hi, std::ref(pred), std::ref(proj));
+					},
+					[](auto x, auto y) { return x + y; });
+			} else {
+				return (*this)(std::move(first), std::move(last),
+					std::ref(pred), std::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy E, ForwardRange R, class Proj = identity,
+			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
+		iter_difference_t<iterator_t<R>>
+		operator()(E&& exec, R&& r, Pred pred, Proj proj = Proj{}) const {
+			return (*this)(std::forward<E>(exec), __stl2::begin(r), __stl2::end(r),
 				std::ref(pred), std::ref(proj));
 		}
 	};
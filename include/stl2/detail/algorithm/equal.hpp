@@ -15,7 +15,9 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // equal [alg.equal]
@@ -28,6 +30,17 @@ STL2_OPEN_NAMESPACE {
 		static constexpr bool __equal_3(I1 first1, S1 last1, I2 first2, Pred& pred,
 			Proj1& proj1, Proj2& proj2)
 		{
+			if constexpr (SizedSentinel<S1, I1> &&
+				detail::simd::Comparable<I1, I2, Pred, Proj1, Proj2>)
+			{
+				auto const n = iter_difference_t<I1>(last1 - first1);
+				if (!detail::simd::constant_evaluated(first1, n) ||
+					!detail::simd::constant_evaluated(first2, n))
+				{
+					return detail::simd::equal(detail::simd::data(first1, n),
+						detail::simd::data(first2, n), n);
+				}
+			}
 			for (; first1 != last1; ++first1, ++first2) {
 				if (!__stl2::invoke(pred, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2))) {
 					return false;
@@ -117,6 +130,43 @@ STL2_OPEN_NAMESPACE {
 					pred, proj1, proj2);
 			}
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy E, ForwardIterator I1, Sentinel<I1> S1,
+			ForwardIterator I2, Sentinel<I2> S2,
+			class Pred = equal_to<>, class Proj1 = identity, class Proj2 = identity>
+		requires IndirectlyComparable<I1, I2, Pred, Proj1, Proj2>
+		bool operator()(E&&, I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = Pred{},
+			Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+		{
+			if constexpr (detail::Parallelizable<E, I1, S1> && detail::Parallelizable<E, I2, S2>) {
+				auto const n = static_cast<std::ptrdiff_t>(last1 - first1);
+				if (n != static_cast<std::ptrdiff_t>(last2 - first2)) {
+					return false;
+				}
+				// Stop all chunks as soon as one finds a difference.
+				return detail::parallel_find<true>(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					return __equal_fn::__equal_3(first1 + lo, first1 + hi, first2 + lo,
+						pred, proj1, proj2) ? hi : lo;
+				}) == n;
+			} else {
+				return (*this)(std::move(first1), std::move(last1),
+					std::move(first2), std::move(last2),
+					std::ref(pred), std::ref(proj1), std::ref(proj2));
+			}
+		}
+
+		template<ext::ExecutionPolicy E, ForwardRange R1, ForwardRange R2, class Pred = equal_to<>,
+			class Proj1 = identity, class Proj2 = identity>
+		requires IndirectlyComparable<iterator_t<R1>, iterator_t<R2>, Pred, Proj1, Proj2>
+		bool operator()(E&& exec, R1&& r1, R2&& r2, Pred pred = Pred{},
+			Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+		{
+			return (*this)(std::forward<E>(exec),
+				__stl2::begin(r1), __stl2::end(r1),
+				__stl2::begin(r2), __stl2::end(r2),
+				std::ref(pred), std::ref(proj1), std::ref(proj2));
+		}
 	};
 
 	inline constexpr __equal_fn equal {};
@@ -13,7 +13,10 @@
 #define STL2_DETAIL_ALGORITHM_FILL_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution/parallel.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // fill [alg.fill]
@@ -21,6 +24,16 @@ STL2_OPEN_NAMESPACE {
 	template<class T, OutputIterator<const T&> O, Sentinel<O> S>
 	O fill(O first, S last, const T& value)
 	{
+		if constexpr (SizedSentinel<S, O> && detail::bitwise::Fillable<O, T>) {
+			auto const n = iter_difference_t<O>(last - first);
+			detail::bitwise::fill_n(first, n, value);
+			return first + n;
+		} else if constexpr (detail::segmented::Hierarchical<O, S>) {
+			return detail::segmented::for_each_local(first, last,
+				[&](auto lfirst, auto llast) {
+					__stl2::fill(std::move(lfirst), std::move(llast), value);
+				});
+		}
 		for (; first != last; ++first) {
 			*first = value;
 		}
@@ -32,6 +45,28 @@ STL2_OPEN_NAMESPACE {
 	{
 		return __stl2::fill(__stl2::begin(rng), __stl2::end(rng), value);
 	}
+
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, class T, OutputIterator<const T&> O, Sentinel<O> S>
+	O fill(E&&, O first, S last, const T& value)
+	{
+		if constexpr (detail::Parallelizable<E, O, S>) {
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+				__stl2::fill(first + lo, first + hi, value);
+			});
+			return first + n;
+		} else {
+			return __stl2::fill(std::move(first), std::move(last), value);
+		}
+	}
+
+	template<ext::ExecutionPolicy E, class T, OutputRange<const T&> Rng>
+	safe_iterator_t<Rng> fill(E&& exec, Rng&& rng, const T& value)
+	{
+		return __stl2::fill(std::forward<E>(exec),
+			__stl2::begin(rng), __stl2::end(rng), value);
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -13,6 +13,7 @@
 #define STL2_DETAIL_ALGORITHM_FILL_N_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/fwd.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -21,6 +22,13 @@
 STL2_OPEN_NAMESPACE {
 	template<class T, OutputIterator<const T&> O>
 	O fill_n(O first, iter_difference_t<O> n, const T& value) {
+		if constexpr (detail::bitwise::Fillable<O, T>) {
+			if (n <= 0) {
+				return first;
+			}
+			detail::bitwise::fill_n(first, n, value);
+			return first + n;
+		}
 		for (; n > 0; --n, ++first) {
 			*first = value;
 		}
@@ -15,7 +15,9 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // find [alg.find]
@@ -25,6 +27,31 @@ STL2_OPEN_NAMESPACE {
 		template<InputIterator I, Sentinel<I> S, class T, class Proj = identity>
 		requires IndirectRelation<equal_to<>, projected<I, Proj>, const T*>
 		constexpr I operator()(I first, S last, const T& value, Proj proj = Proj{}) const {
+			if constexpr (detail::simd::Searchable<I, S, T, Proj>) {
+				auto const n = iter_difference_t<I>(last - first);
+				if (!detail::simd::constant_evaluated(first, n)) {
+					auto const p = detail::simd::data(first, n);
+					return first + (detail::simd::find(p, p + n, value) - p);
+				}
+			} else if constexpr (detail::segmented::Segmentable<I, S> &&
+				IndirectRelation<equal_to<>, projected<const iter_value_t<I>*, Proj>, const T*>)
+			{
+				for (auto seg = first.segment(); !seg.empty(); seg = first.segment()) {
+					auto const p = seg.data();
+					auto const k = (*this)(p, p + seg.size(), value, std::ref(proj)) - p;
+					first.consume(k);
+					if (k != seg.size()) {
+						break;
+					}
+				}
+				return first;
+			} else if constexpr (detail::segmented::Hierarchical<I, S>) {
+				return detail::segmented::find_local(first, last,
+					[&](auto lfirst, auto llast) {
+						return (*this)(std::move(lfirst), std::move(llast),
+							value, std::ref(proj));
+					});
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(proj, *first) == value) {
 					break;
@@ -16,6 +16,8 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution/parallel.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // find_if [alg.find]
@@ -26,6 +28,13 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr I operator()(I first, S last, Pred pred, Proj proj = Proj{}) const
 		{
+			if constexpr (detail::segmented::Hierarchical<I, S>) {
+				return detail::segmented::find_local(first, last,
+					[&](auto lfirst, auto llast) {
+						return (*this)(std::move(lfirst), std::move(llast),
+							std::ref(pred), std::ref(proj));
+					});
+			}
 			for (; first != last; ++first) {
 				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
 					break;
@@ -41,6 +50,31 @@ STL2_OPEN_NAMESPACE {
 			return (*this)(__stl2::begin(r), __stl2::end(r),
 				std::ref(pred), std::ref(proj));
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S, class Proj = identity,
+			IndirectUnaryPredicate<projected<I, Proj>> Pred>
+		I operator()(E&&, I first, S last, Pred pred, Proj proj = Proj{}) const
+		{
+			if constexpr (detail::Parallelizable<E, I, S>) {
+				auto const n = static_cast<std::ptrdiff_t>(last - first);
+				return first + detail::parallel_find(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					return static_cast<std::ptrdiff_t>((*this)(first + lo, first + hi,
+						std::ref(pred), std::ref(proj)) - first);
+				});
+			} else {
+				return (*this)(std::move(first), std::move(last),
+					std::ref(pred), std::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy E, ForwardRange R, class Proj = identity,
+			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
+		safe_iterator_t<R> operator()(E&& exec, R&& r, Pred pred, Proj proj = Proj{}) const
+		{
+			return (*this)(std::forward<E>(exec), __stl2::begin(r), __stl2::end(r),
+				std::ref(pred), std::ref(proj));
+		}
 	};
 
 	inline constexpr __find_if_fn find_if {};
@@ -17,6 +17,10 @@
 #include <stl2/utility.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution/parallel.hpp>
+#include <stl2/detail/iterator/chunked.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // for_each [alg.for_each]
@@ -28,6 +32,25 @@ STL2_OPEN_NAMESPACE {
 		constexpr tagged_pair<tag::in(I), tag::fun(F)>
 		operator()(I first, S last, F fun, Proj proj = Proj{}) const
 		{
+			// fun sees the buffered values only when it cannot tell them
+			// from the elements, which are prvalues.
+			if constexpr (detail::chunked::Chunkable<I, S> &&
+				!std::is_reference<iter_reference_t<I>>::value &&
+				IndirectUnaryInvocable<F, projected<iter_value_t<I>*, Proj>>)
+			{
+				detail::chunked::for_each(first, [&](auto chunk) {
+					(*this)(chunk.data(), chunk.data() + chunk.size(),
+						std::ref(fun), std::ref(proj));
+				});
+				return {std::move(first), std::move(fun)};
+			} else if constexpr (detail::segmented::Hierarchical<I, S>) {
+				first = detail::segmented::for_each_local(first, last,
+					[&](auto lfirst, auto llast) {
+						(*this)(std::move(lfirst), std::move(llast),
+							std::ref(fun), std::ref(proj));
+					});
+				return {std::move(first), std::move(fun)};
+			}
 			for (; first != last; ++first) {
 				static_cast<void>(__stl2::invoke(fun, __stl2::invoke(proj, *first)));
 			}
@@ -39,7 +62,43 @@ STL2_OPEN_NAMESPACE {
 		constexpr tagged_pair<tag::in(safe_iterator_t<R>), tag::fun(F)>
 		operator()(R&& r, F fun, Proj proj = Proj{}) const
 		{
-			return {(*this)(__stl2::begin(r), __stl2::end(r),
+			if constexpr (CommonRange<R> && detail::InternallyIterable<R>) {
+				__stl2::ext::for_each_while(r, [&](auto&& x) -> bool {
+					static_cast<void>(__stl2::invoke(fun,
+						__stl2::invoke(proj, std::forward<decltype(x)>(x))));
+					return true;
+				});
+				return {__stl2::end(r), std::move(fun)};
+			} else {
+				return {(*this)(__stl2::begin(r), __stl2::end(r),
+					std::ref(fun), std::ref(proj)).in(), std::move(fun)};
+			}
+		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S, class Proj = identity,
+			IndirectUnaryInvocable<projected<I, Proj>> F>
+		tagged_pair<tag::in(I), tag::fun(F)>
+		operator()(E&&, I first, S last, F fun, Proj proj = Proj{}) const
+		{
+			if constexpr (detail::Parallelizable<E, I, S>) {
+				auto const n = static_cast<std::ptrdiff_t>(last - first);
+				detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					(*this)(first + lo, first + hi, std::ref(fun), std::ref(proj));
+				});
+				return {first + n, std::move(fun)};
+			} else {
+				return (*this)(std::move(first), std::move(last),
+					std::move(fun), std::move(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy E, ForwardRange R, class Proj = identity,
+			IndirectUnaryInvocable<projected<iterator_t<R>, Proj>> F>
+		tagged_pair<tag::in(safe_iterator_t<R>), tag::fun(F)>
+		operator()(E&& exec, R&& r, F fun, Proj proj = Proj{}) const
+		{
+			return {(*this)(std::forward<E>(exec), __stl2::begin(r), __stl2::end(r),
 				std::ref(fun), std::ref(proj)).in(), std::move(fun)};
 		}
 	};
@@ -47,12 +47,13 @@ STL2_OPEN_NAMESPACE {
 			}
 			iter_reference_t<I1>&& v1 = *first1;
 			iter_reference_t<I2>&& v2 = *first2;
-			if (__stl2::invoke(comp, __stl2::invoke(proj1, v1), __stl2::invoke(proj2, v2))) {
-				*result = std::forward<iter_reference_t<I1>>(v1);
-				++first1;
-			} else {
+			// Take from the first range on ties, for stability.
+			if (__stl2::invoke(comp, __stl2::invoke(proj2, v2), __stl2::invoke(proj1, v1))) {
 				*result = std::forward<iter_reference_t<I2>>(v2);
 				++first2;
+			} else {
+				*result = std::forward<iter_reference_t<I1>>(v1);
+				++first1;
 			}
 			++result;
 		}
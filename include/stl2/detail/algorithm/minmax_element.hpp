@@ -22,6 +22,7 @@
 #include <stl2/detail/algorithm/tagspec.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // minmax_element [alg.min.max]
@@ -84,6 +85,63 @@ STL2_OPEN_NAMESPACE {
 		return __stl2::minmax_element(__stl2::begin(rng), __stl2::end(rng),
 			std::ref(comp), std::ref(proj));
 	}
+
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		IndirectStrictWeakOrder<
+			Comp, projected<I, Proj>>
+	tagged_pair<tag::min(I), tag::max(I)>
+	minmax_element(E&&, I first, S last, Comp comp = Comp{}, Proj proj = Proj{})
+	{
+		if constexpr (detail::Parallelizable<E, I, S>) {
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			if (n == 0) {
+				return {first, first};
+			}
+			using P = std::pair<std::ptrdiff_t, std::ptrdiff_t>;
+			auto const r = detail::parallel_reduce<P>(n,
+				[&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					auto m = __stl2::minmax_element(first + lo, first + hi,
+						std::ref(comp), std::ref(proj));
+					return P{static_cast<std::ptrdiff_t>(m.min() - first),
+						static_cast<std::ptrdiff_t>(m.max() - first)};
+				},
+				[&](P x, P y) {
+					// Keep the first smallest and the last largest element.
+					if (__stl2::invoke(comp, __stl2::invoke(proj, first[y.first]),
+						__stl2::invoke(proj, first[x.first])))
+					{
+						x.first = y.first;
+					}
+					if (!__stl2::invoke(comp, __stl2::invoke(proj, first[y.second]),
+						__stl2::invoke(proj, first[x.second])))
+					{
+						x.second = y.second;
+					}
+					return x;
+				});
+			return {first + r.first, first + r.second};
+		} else {
+			return __stl2::minmax_element(std::move(first), std::move(last),
+				std::ref(comp), std::ref(proj));
+		}
+	}
+
+	template<ext::ExecutionPolicy E, ForwardRange Rng,
+		class Comp = less<>, class Proj = identity>
+	requires
+		IndirectStrictWeakOrder<
+			Comp, projected<iterator_t<Rng>, Proj>>
+	tagged_pair<tag::min(safe_iterator_t<Rng>),
+		tag::max(safe_iterator_t<Rng>)>
+	minmax_element(E&& exec, Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{})
+	{
+		return __stl2::minmax_element(std::forward<E>(exec),
+			__stl2::begin(rng), __stl2::end(rng),
+			std::ref(comp), std::ref(proj));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -15,8 +15,10 @@
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <stl2/detail/simd.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // mismatch [mismatch]
@@ -49,6 +51,20 @@ STL2_OPEN_NAMESPACE {
 		operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = Pred{},
 			Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
 		{
+			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2> &&
+				detail::simd::Comparable<I1, I2, Pred, Proj1, Proj2>)
+			{
+				auto const n1 = iter_difference_t<I1>(last1 - first1);
+				auto const n2 = iter_difference_t<I1>(last2 - first2);
+				auto const n = n1 < n2 ? n1 : n2;
+				if (!detail::simd::constant_evaluated(first1, n) ||
+					!detail::simd::constant_evaluated(first2, n))
+				{
+					auto const i = detail::simd::mismatch(detail::simd::data(first1, n),
+						detail::simd::data(first2, n), n);
+					return {first1 + i, first2 + i};
+				}
+			}
 			for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
 				if (!__stl2::invoke(pred, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2))) {
 					break;
@@ -92,6 +108,48 @@ STL2_OPEN_NAMESPACE {
 				std::ref(proj1),
 				std::ref(proj2));
 		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy E, ForwardIterator I1, Sentinel<I1> S1,
+			ForwardIterator I2, Sentinel<I2> S2,
+			class Proj1 = identity, class Proj2 = identity,
+			IndirectRelation<projected<I1, Proj1>, projected<I2, Proj2>> Pred = equal_to<>>
+		tagged_pair<tag::in1(I1), tag::in2(I2)>
+		operator()(E&&, I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = Pred{},
+			Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+		{
+			if constexpr (detail::Parallelizable<E, I1, S1> && detail::Parallelizable<E, I2, S2>) {
+				auto const n1 = static_cast<std::ptrdiff_t>(last1 - first1);
+				auto const n2 = static_cast<std::ptrdiff_t>(last2 - first2);
+				auto const i = detail::parallel_find(n1 < n2 ? n1 : n2,
+					[&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+						return static_cast<std::ptrdiff_t>((*this)(
+							first1 + lo, first1 + hi, first2 + lo, first2 + hi,
+							std::ref(pred), std::ref(proj1), std::ref(proj2)).in1() - first1);
+					});
+				return {first1 + i, first2 + i};
+			} else {
+				return (*this)(std::move(first1), std::move(last1),
+					std::move(first2), std::move(last2),
+					std::ref(pred), std::ref(proj1), std::ref(proj2));
+			}
+		}
+
+		template<ext::ExecutionPolicy E, ForwardRange R1, ForwardRange R2,
+			class Proj1 = identity, class Proj2 = identity,
+			IndirectRelation<projected<iterator_t<R1>, Proj1>,
+				projected<iterator_t<R2>, Proj2>> Pred = equal_to<>>
+		tagged_pair<tag::in1(safe_iterator_t<R1>), tag::in2(safe_iterator_t<R2>)>
+		operator()(E&& exec, R1&& r1, R2&& r2, Pred pred = Pred{},
+			Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
+		{
+			return (*this)(std::forward<E>(exec),
+				__stl2::begin(r1), __stl2::end(r1),
+				__stl2::begin(r2), __stl2::end(r2),
+				std::ref(pred),
+				std::ref(proj1),
+				std::ref(proj2));
+		}
 	};
 
 	inline constexpr __mismatch_fn mismatch {};
@@ -13,6 +13,7 @@
 #define STL2_DETAIL_ALGORITHM_MOVE_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
@@ -26,6 +27,13 @@ STL2_OPEN_NAMESPACE {
 		IndirectlyMovable<I, O>
 	tagged_pair<tag::in(I), tag::out(O)>
 	move(I first, S last, O result) {
+		if constexpr (SizedSentinel<S, I> &&
+			detail::bitwise::Assignable<I, O, iter_rvalue_reference_t<I>>)
+		{
+			auto const n = iter_difference_t<I>(last - first);
+			detail::bitwise::copy_n(first, n, result);
+			return {first + n, result + n};
+		}
 		for (; first != last; ++first, ++result) {
 			*result = __stl2::iter_move(first);
 		}
@@ -14,6 +14,7 @@
 
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -26,6 +27,12 @@ STL2_OPEN_NAMESPACE {
 	tagged_pair<tag::in(I1), tag::out(I2)>
 	move_backward(I1 first, I1 last, I2 result)
 	{
+		if constexpr (detail::bitwise::Assignable<I1, I2, iter_rvalue_reference_t<I1>>) {
+			auto const n = iter_difference_t<I1>(last - first);
+			result -= n;
+			detail::bitwise::copy_n(first, n, result);
+			return {std::move(last), std::move(result)};
+		}
 		auto i = last;
 		while (i != first) {
 			*--result = __stl2::iter_move(--i);
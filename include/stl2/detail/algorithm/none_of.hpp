@@ -16,6 +16,8 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // none_of [alg.none_of]
@@ -38,7 +40,39 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
 		constexpr bool operator()(R&& r, Pred pred, Proj proj = Proj{}) const
 		{
-			return (*this)(__stl2::begin(r), __stl2::end(r),
+			if constexpr (detail::InternallyIterable<R>) {
+				return __stl2::ext::for_each_while(r, [&](auto&& x) -> bool {
+					return !__stl2::invoke(pred, __stl2::invoke(proj, std::forward<decltype(x)>(x)));
+				});
+			} else {
+				return (*this)(__stl2::begin(r), __stl2::end(r),
+					std::ref(pred), std::ref(proj));
+			}
+		}
+
+		// Extension: execution policies
+		template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S, class Proj = identity,
+			IndirectUnaryPredicate<projected<I, Proj>> Pred>
+		bool operator()(E&&, I first, S last, Pred pred, Proj proj = Proj{}) const
+		{
+			if constexpr (detail::Parallelizable<E, I, S>) {
+				// Stop all chunks as soon as one finds a match.
+				auto const n = static_cast<std::ptrdiff_t>(last - first);
+				return detail::parallel_find<true>(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					return (*this)(first + lo, first + hi, std::ref(pred), std::ref(proj)) ?
+						hi : lo;
+				}) == n;
+			} else {
+				return (*this)(std::move(first), std::move(last),
+					std::ref(pred), std::ref(proj));
+			}
+		}
+
+		template<ext::ExecutionPolicy E, ForwardRange R, class Proj = identity,
+			IndirectUnaryPredicate<projected<iterator_t<R>, Proj>> Pred>
+		bool operator()(E&& exec, R&& r, Pred pred, Proj proj = Proj{}) const
+		{
+			return (*this)(std::forward<E>(exec), __stl2::begin(r), __stl2::end(r),
 				std::ref(pred), std::ref(proj));
 		}
 	};
@@ -26,6 +26,7 @@
 #include <stl2/iterator.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/min_element.hpp>
+#include <stl2/detail/algorithm/random_access_sort.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -86,6 +87,10 @@ STL2_OPEN_NAMESPACE {
 	I nth_element(I first, I nth, S last, Comp comp = Comp{}, Proj proj = Proj{})
 	{
 		I end = __stl2::next(nth, last), end_orig = end;
+		if constexpr (detail::rsort::BranchlessSortable<I, Comp, Proj>) {
+			detail::rsort::pdqselect(first, nth, end, comp, proj);
+			return end_orig;
+		}
 		constexpr iter_difference_t<I> limit = 7;
 		while (true) {
 		restart:
@@ -18,6 +18,7 @@
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/heap_sift.hpp>
 #include <stl2/detail/algorithm/make_heap.hpp>
+#include <stl2/detail/algorithm/random_access_sort.hpp>
 #include <stl2/detail/algorithm/sort_heap.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
@@ -31,6 +32,14 @@ STL2_OPEN_NAMESPACE {
 		Sortable<I, Comp, Proj>
 	I partial_sort(I first, I middle, S last, Comp comp = Comp{}, Proj proj = Proj{})
 	{
+		if constexpr (detail::rsort::BranchlessSortable<I, Comp, Proj>) {
+			// Cheap comparisons: select, then sort the prefix, in
+			// O(N + M log M) instead of the heap's O(N log M).
+			I end = __stl2::next(middle, std::move(last));
+			detail::rsort::pdqselect(first, middle, end, comp, proj);
+			detail::rsort::pdqsort(first, middle, comp, proj);
+			return end;
+		}
 		__stl2::make_heap(first, middle, std::ref(comp), std::ref(proj));
 		const auto len = __stl2::distance(first, middle);
 		I i = middle;
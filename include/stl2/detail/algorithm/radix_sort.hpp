@@ -0,0 +1,342 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/move.hpp>
+#include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/algorithm.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// radix_sort [Extension]
+//
+// Sorts by the bytes of a projected key instead of by comparison:
+// * integral keys sort in numeric order,
+// * IEEE-754 floating-point keys sort in the total order
+//   -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN,
+// * std::array keys of byte-sized elements sort lexicographically by
+//   unsigned byte value.
+//
+// ext::radix_sort is a stable LSD radix sort that ping-pongs through a
+// temporary buffer; it degrades to stable_sort if no buffer can be
+// obtained. ext::inplace_radix_sort is an unstable in-place MSD
+// ("American flag") radix sort.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		namespace radix {
+			// radix_traits<K>::byte(k, i) is the i-th least significant byte
+			// of the order-preserving unsigned encoding of k.
+			template<class>
+			struct radix_traits {};
+
+			template<class T>
+			requires
+				Integral<T> && !Same<T, bool>
+			struct radix_traits<T> {
+				static constexpr std::size_t size = sizeof(T);
+				using U = std::make_unsigned_t<T>;
+
+				static constexpr U encode(T t) noexcept {
+					if constexpr (SignedIntegral<T>) {
+						// Flip the sign bit so negative values sort first.
+						return static_cast<U>(static_cast<U>(t) ^
+							(U{1} << (sizeof(U) * CHAR_BIT - 1)));
+					} else {
+						return static_cast<U>(t);
+					}
+				}
+				static constexpr unsigned char byte(T t, std::size_t i) noexcept {
+					return static_cast<unsigned char>(encode(t) >> (i * CHAR_BIT));
+				}
+			};
+
+			template<class T>
+			requires
+				std::is_floating_point<T>::value &&
+				std::numeric_limits<T>::is_iec559 &&
+				(sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t))
+			struct radix_traits<T> {
+				static constexpr std::size_t size = sizeof(T);
+				using U = meta::if_c<sizeof(T) == sizeof(std::uint32_t),
+					std::uint32_t, std::uint64_t>;
+
+				static U encode(T t) noexcept {
+					U u;
+					std::memcpy(&u, &t, sizeof(u));
+					constexpr U sign = U{1} << (sizeof(U) * CHAR_BIT - 1);
+					// Negative values: invert all bits so larger magnitudes sort
+					// first. Non-negative values: set the sign bit so they sort
+					// after all negative values.
+					return (u & sign) ? static_cast<U>(~u) : static_cast<U>(u | sign);
+				}
+				static unsigned char byte(T t, std::size_t i) noexcept {
+					return static_cast<unsigned char>(encode(t) >> (i * CHAR_BIT));
+				}
+			};
+
+			template<class B, std::size_t N>
+			requires
+				sizeof(B) == 1 && (Integral<B> || Same<B, std::byte>)
+			struct radix_traits<std::array<B, N>> {
+				static constexpr std::size_t size = N;
+
+				static constexpr unsigned char byte(const std::array<B, N>& a, std::size_t i) noexcept {
+					return static_cast<unsigned char>(a[N - 1 - i]);
+				}
+			};
+
+			template<class K>
+			concept bool RadixKey =
+				requires(const K& k, std::size_t i) {
+					radix_traits<K>::size;
+					{ radix_traits<K>::byte(k, i) } -> Same<unsigned char>;
+				};
+
+			template<class I, class Proj>
+			using key_t = __uncvref<indirect_result_t<Proj&, I>>;
+
+			template<class K>
+			constexpr unsigned char byte(const K& k, std::size_t i) noexcept {
+				return radix_traits<K>::byte(k, i);
+			}
+
+			// The order radix sort establishes, as a comparison.
+			struct radix_less {
+				template<RadixKey K>
+				constexpr bool operator()(const K& x, const K& y) const noexcept {
+					for (auto i = radix_traits<K>::size; i-- > 0;) {
+						auto const a = radix::byte(x, i);
+						auto const b = radix::byte(y, i);
+						if (a != b) {
+							return a < b;
+						}
+					}
+					return false;
+				}
+			};
+
+			constexpr std::size_t buckets = 1u << CHAR_BIT;
+
+			// Below this size, buckets are finished with insertion sort.
+			constexpr std::ptrdiff_t insertion_sort_threshold = 32;
+
+			// Stable counting-sort scatter of [src, src + n) into dst by byte
+			// i of the key, given the histogram of that byte.
+			template<class K, RandomAccessIterator In, RandomAccessIterator Out, class Proj>
+			void lsd_scatter(In src, iter_difference_t<In> n, Out dst,
+				const std::ptrdiff_t* count, std::size_t i, Proj& proj)
+			{
+				std::ptrdiff_t offset[buckets];
+				std::ptrdiff_t sum = 0;
+				for (std::size_t b = 0; b < buckets; ++b) {
+					offset[b] = sum;
+					sum += count[b];
+				}
+				for (; n > 0; --n, ++src) {
+					K const& k = __stl2::invoke(proj, *src);
+					*(dst + offset[radix::byte(k, i)]++) = __stl2::iter_move(src);
+				}
+			}
+
+			template<RandomAccessIterator I, class Proj>
+			requires
+				RadixKey<key_t<I, Proj>>
+			void lsd_sort(I first, iter_difference_t<I> n,
+				temporary_buffer<iter_value_t<I>>& buf, Proj& proj)
+			{
+				using K = key_t<I, Proj>;
+				constexpr std::size_t size = radix_traits<K>::size;
+				auto count = std::make_unique<std::ptrdiff_t[]>(size * buckets);
+
+				// The bytes of the first key tell which bytes every key
+				// agrees on. They're read now, since the passes leave
+				// moved-from elements behind them.
+				unsigned char first_key[size];
+				{
+					K const& k = __stl2::invoke(proj, *first);
+					for (std::size_t i = 0; i < size; ++i) {
+						first_key[i] = radix::byte(k, i);
+					}
+				}
+
+				// One pass computes every byte histogram while moving the
+				// elements into the buffer.
+				temporary_vector<iter_value_t<I>> vec{buf};
+				for (iter_difference_t<I> j = 0; j < n; ++j) {
+					K const& k = __stl2::invoke(proj, first[j]);
+					for (std::size_t i = 0; i < size; ++i) {
+						++count[i * buckets + radix::byte(k, i)];
+					}
+					vec.emplace_back(__stl2::iter_move(first + j));
+				}
+
+				bool in_buffer = true;
+				for (std::size_t i = 0; i < size; ++i) {
+					const std::ptrdiff_t* c = &count[i * buckets];
+					// Skip bytes on which every key agrees.
+					if (c[first_key[i]] == n) {
+						continue;
+					}
+					if (in_buffer) {
+						radix::lsd_scatter<K>(vec.begin(), n, first, c, i, proj);
+					} else {
+						radix::lsd_scatter<K>(first, n, vec.begin(), c, i, proj);
+					}
+					in_buffer = !in_buffer;
+				}
+				if (in_buffer) {
+					__stl2::move(vec.begin(), vec.end(), first);
+				}
+			}
+
+			template<RandomAccessIterator I, class Proj>
+			requires
+				RadixKey<key_t<I, Proj>>
+			void msd_sort(I first, iter_difference_t<I> n, std::size_t i, Proj& proj)
+			{
+				using K = key_t<I, Proj>;
+				radix_less comp{};
+				while (true) {
+					if (n < insertion_sort_threshold) {
+						rsort::insertion_sort(first, first + n, comp, proj);
+						return;
+					}
+
+					std::ptrdiff_t count[buckets] = {};
+					for (iter_difference_t<I> j = 0; j < n; ++j) {
+						++count[radix::byte(K(__stl2::invoke(proj, first[j])), i)];
+					}
+
+					std::ptrdiff_t next[buckets];
+					std::ptrdiff_t end[buckets];
+					std::ptrdiff_t sum = 0;
+					for (std::size_t b = 0; b < buckets; ++b) {
+						next[b] = sum;
+						sum += count[b];
+						end[b] = sum;
+					}
+
+					if (count[radix::byte(K(__stl2::invoke(proj, *first)), i)] != n) {
+						// Permute each element directly into its bucket.
+						for (std::size_t b = 0; b < buckets; ++b) {
+							while (next[b] < end[b]) {
+								auto const d = radix::byte(K(__stl2::invoke(proj, first[next[b]])), i);
+								if (d == b) {
+									++next[b];
+								} else {
+									__stl2::iter_swap(first + next[b], first + next[d]++);
+								}
+							}
+						}
+					}
+
+					if (i == 0) {
+						return;
+					}
+					--i;
+					// Recurse on all but the largest bucket, and loop on that
+					// one to bound the stack depth.
+					std::size_t largest = 0;
+					for (std::size_t b = 1; b < buckets; ++b) {
+						if (count[b] > count[largest]) {
+							largest = b;
+						}
+					}
+					for (std::size_t b = 0; b < buckets; ++b) {
+						if (b != largest && count[b] > 1) {
+							radix::msd_sort(first + (end[b] - count[b]), count[b], i, proj);
+						}
+					}
+					first += end[largest] - count[largest];
+					n = count[largest];
+				}
+			}
+		}
+	}
+
+	namespace ext {
+		template<class I, class Proj = identity>
+		concept bool RadixSortable =
+			RandomAccessIterator<I> &&
+			Sortable<I, detail::radix::radix_less, Proj> &&
+			detail::radix::RadixKey<detail::radix::key_t<I, Proj>>;
+
+		template<RandomAccessIterator I, Sentinel<I> S, class Proj = identity>
+		requires
+			RadixSortable<I, Proj>
+		I radix_sort(I first, S last_, Proj proj = Proj{})
+		{
+			auto last = __stl2::next(first, std::move(last_));
+			auto n = iter_difference_t<I>(last - first);
+			if (n < detail::radix::insertion_sort_threshold) {
+				detail::radix::radix_less comp{};
+				detail::rsort::insertion_sort(first, last, comp, proj);
+				return last;
+			}
+			detail::temporary_buffer<iter_value_t<I>> buf{n};
+			if (buf.size() < n) {
+				return __stl2::stable_sort(first, last,
+					detail::radix::radix_less{}, std::ref(proj));
+			}
+			detail::radix::lsd_sort(first, n, buf, proj);
+			return last;
+		}
+
+		template<RandomAccessRange Rng, class Proj = identity>
+		requires
+			RadixSortable<iterator_t<Rng>, Proj>
+		safe_iterator_t<Rng> radix_sort(Rng&& rng, Proj proj = Proj{})
+		{
+			return ext::radix_sort(__stl2::begin(rng), __stl2::end(rng),
+				std::ref(proj));
+		}
+
+		template<RandomAccessIterator I, Sentinel<I> S, class Proj = identity>
+		requires
+			RadixSortable<I, Proj>
+		I inplace_radix_sort(I first, S last_, Proj proj = Proj{})
+		{
+			auto last = __stl2::next(first, std::move(last_));
+			auto n = iter_difference_t<I>(last - first);
+			if (n > 1) {
+				using K = detail::radix::key_t<I, Proj>;
+				detail::radix::msd_sort(first, n,
+					detail::radix::radix_traits<K>::size - 1, proj);
+			}
+			return last;
+		}
+
+		template<RandomAccessRange Rng, class Proj = identity>
+		requires
+			RadixSortable<iterator_t<Rng>, Proj>
+		safe_iterator_t<Rng> inplace_radix_sort(Rng&& rng, Proj proj = Proj{})
+		{
+			return ext::inplace_radix_sort(__stl2::begin(rng), __stl2::end(rng),
+				std::ref(proj));
+		}
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
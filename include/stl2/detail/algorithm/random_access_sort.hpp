@@ -10,6 +10,14 @@
 //
 // Project home: https://github.com/caseycarter/cmcstl2
 //
+//===----------------------------------------------------------------------===//
+//
+// The pattern-defeating quicksort is derived from pdqsort,
+// Copyright (c) 2015 Orson Peters, distributed under the zlib license.
+// See https://github.com/orlp/pdqsort for details.
+//
+//===----------------------------------------------------------------------===//
+//
 #ifndef STL2_DETAIL_ALGORITHM_RANDOM_ACCESS_SORT_HPP
 #define STL2_DETAIL_ALGORITHM_RANDOM_ACCESS_SORT_HPP
 
@@ -18,7 +26,8 @@
 #include <stl2/tuple.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/move_backward.hpp>
-#include <stl2/detail/algorithm/partial_sort.hpp>
+#include <stl2/detail/algorithm/make_heap.hpp>
+#include <stl2/detail/algorithm/sort_heap.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/fundamental.hpp>
 
@@ -28,48 +37,6 @@
 STL2_OPEN_NAMESPACE {
 	namespace detail {
 		namespace rsort {
-			template<RandomAccessIterator I, class Comp, class Proj>
-			requires
-				Sortable<I, Comp, Proj>
-			I choose_pivot(I first, I last, Comp& comp, Proj& proj)
-			{
-				STL2_EXPECT(first != last);
-				I mid = first + iter_difference_t<I>(last - first) / 2;
-				--last;
-				// Find the median:
-				return [&](auto&& a, auto&& b, auto&& c) {
-					return __stl2::invoke(comp, a, b)
-						? (__stl2::invoke(comp, b, c) ? mid   : (__stl2::invoke(comp, a, c) ? last : first))
-						: (__stl2::invoke(comp, a, c) ? first : (__stl2::invoke(comp, b, c) ? last : mid  ));
-				}(__stl2::invoke(proj, *first), __stl2::invoke(proj, *mid), __stl2::invoke(proj, *last));
-			}
-
-			template<RandomAccessIterator I, class Comp, class Proj>
-			requires
-				Sortable<I, Comp, Proj>
-			I unguarded_partition(I first, I last, Comp& comp, Proj& proj)
-			{
-				I pivot_pnt = rsort::choose_pivot(first, last, comp, proj);
-
-				// Do the partition:
-				while (true) {
-					auto &&v = *pivot_pnt;
-					auto &&pivot = __stl2::invoke(proj, (decltype(v) &&)v);
-					while (__stl2::invoke(comp, __stl2::invoke(proj, *first), pivot)) {
-						++first;
-					}
-					while (__stl2::invoke(comp, pivot, __stl2::invoke(proj, *--last))) {
-						;
-					}
-					if (!(first < last)) {
-						return first;
-					}
-					__stl2::iter_swap(first, last);
-					pivot_pnt = pivot_pnt == first ? last : (pivot_pnt == last ? first : pivot_pnt);
-					++first;
-				}
-			}
-
 			template<BidirectionalIterator I, class Comp, class Proj>
 			requires
 				Sortable<I, Comp, Proj>
@@ -120,8 +87,6 @@ STL2_OPEN_NAMESPACE {
 				}
 			}
 
-			constexpr std::ptrdiff_t introsort_threshold = 16;
-
 			Integral{I}
 			constexpr auto log2(I n) {
 				STL2_EXPECT(n > 0);
@@ -132,33 +97,513 @@ STL2_OPEN_NAMESPACE {
 				return k;
 			}
 
+			///////////////////////////////////////////////////////////////////
+			// Pattern-defeating quicksort
+			//
+			// Partitions below this size are sorted with insertion sort.
+			constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+			// Partitions above this size use Tukey's ninther to select the pivot.
+			constexpr std::ptrdiff_t ninther_threshold = 128;
+			// When a partition is found to be already partitioned, we try an
+			// insertion sort that bails out once this many elements have been
+			// moved.
+			constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+
 			template<RandomAccessIterator I, class Comp, class Proj>
 			requires
 				Sortable<I, Comp, Proj>
-			void introsort_loop(I first, I last, iter_difference_t<I> depth_limit,
-				Comp& comp, Proj& proj)
+			void sort2(I a, I b, Comp& comp, Proj& proj)
 			{
-				while (__stl2::distance(first, last) > introsort_threshold) {
-					if (depth_limit == 0) {
-						__stl2::partial_sort(first, last, last, std::ref(comp), std::ref(proj));
-						return;
+				if (__stl2::invoke(comp, __stl2::invoke(proj, *b), __stl2::invoke(proj, *a))) {
+					__stl2::iter_swap(a, b);
+				}
+			}
+
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			void sort3(I a, I b, I c, Comp& comp, Proj& proj)
+			{
+				rsort::sort2(a, b, comp, proj);
+				rsort::sort2(b, c, comp, proj);
+				rsort::sort2(a, b, comp, proj);
+			}
+
+			// Moves the median of 3 - or pseudomedian of 9 - of [first, last)
+			// to *first.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			void choose_pivot(I first, I last, Comp& comp, Proj& proj)
+			{
+				auto const n = iter_difference_t<I>(last - first);
+				auto const half = n / 2;
+				if (n > ninther_threshold) {
+					rsort::sort3(first, first + half, last - 1, comp, proj);
+					rsort::sort3(first + 1, first + (half - 1), last - 2, comp, proj);
+					rsort::sort3(first + 2, first + (half + 1), last - 3, comp, proj);
+					rsort::sort3(first + (half - 1), first + half, first + (half + 1), comp, proj);
+					__stl2::iter_swap(first, first + half);
+				} else {
+					rsort::sort3(first + half, first, last - 1, comp, proj);
+				}
+			}
+
+			// Insertion sort [first, last) that gives up and returns false if
+			// more than partial_insertion_sort_limit elements must be moved.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			bool partial_insertion_sort(I first, I last, Comp& comp, Proj& proj)
+			{
+				if (first == last) {
+					return true;
+				}
+				iter_difference_t<I> moves = 0;
+				for (I cur = first + 1; cur != last; ++cur) {
+					I sift = cur;
+					I sift_1 = cur - 1;
+					if (__stl2::invoke(comp, __stl2::invoke(proj, *sift), __stl2::invoke(proj, *sift_1))) {
+						iter_value_t<I> tmp = __stl2::iter_move(sift);
+						do {
+							*sift = __stl2::iter_move(sift_1);
+							--sift;
+						} while (sift != first &&
+							__stl2::invoke(comp, __stl2::invoke(proj, tmp), __stl2::invoke(proj, *--sift_1)));
+						*sift = std::move(tmp);
+						moves += cur - sift;
+					}
+					if (moves > partial_insertion_sort_limit) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			// Partitions [first, last) around the pivot *first. Elements
+			// equivalent to the pivot are put in the right partition. Returns
+			// the final position of the pivot, and whether the range was
+			// already partitioned. Requires that [first, last) contain an
+			// element not less than the pivot after the first, and - unless
+			// first is the leftmost iterator - that *prev(first) is not greater
+			// than any element in [first, last).
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			std::pair<I, bool>
+			partition_right(I first, I last, Comp& comp, Proj& proj)
+			{
+				iter_value_t<I> pivot = __stl2::iter_move(first);
+				auto&& p = __stl2::invoke(proj, pivot);
+				I begin = first;
+
+				// Find the first element not less than the pivot (the median
+				// of 3 guarantees one exists).
+				while (__stl2::invoke(comp, __stl2::invoke(proj, *++first), p)) {
+					;
+				}
+				// Find the last element less than the pivot; this search must be
+				// guarded if there was no element before first.
+				if (first - 1 == begin) {
+					while (first < last && !__stl2::invoke(comp, __stl2::invoke(proj, *--last), p)) {
+						;
+					}
+				} else {
+					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--last), p)) {
+						;
+					}
+				}
+
+				// If the first pair of elements to be swapped is the same
+				// element, the input was already partitioned.
+				bool already_partitioned = first >= last;
+
+				while (first < last) {
+					__stl2::iter_swap(first, last);
+					while (__stl2::invoke(comp, __stl2::invoke(proj, *++first), p)) {
+						;
+					}
+					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--last), p)) {
+						;
+					}
+				}
+
+				I pivot_pos = first - 1;
+				*begin = __stl2::iter_move(pivot_pos);
+				*pivot_pos = std::move(pivot);
+				return {pivot_pos, already_partitioned};
+			}
+
+			// Partitions [first, last) around the pivot *first, putting
+			// elements equivalent to the pivot in the left partition. Used
+			// when the pivot is known to be equivalent to *prev(first), in
+			// which case the left partition needs no further sorting. Returns
+			// the final position of the pivot.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			I partition_left(I first, I last, Comp& comp, Proj& proj)
+			{
+				iter_value_t<I> pivot = __stl2::iter_move(first);
+				auto&& p = __stl2::invoke(proj, pivot);
+				I begin = first;
+				I end = last;
+
+				while (__stl2::invoke(comp, p, __stl2::invoke(proj, *--last))) {
+					;
+				}
+				if (last + 1 == end) {
+					while (first < last && !__stl2::invoke(comp, p, __stl2::invoke(proj, *++first))) {
+						;
+					}
+				} else {
+					while (!__stl2::invoke(comp, p, __stl2::invoke(proj, *++first))) {
+						;
+					}
+				}
+
+				while (first < last) {
+					__stl2::iter_swap(first, last);
+					while (__stl2::invoke(comp, p, __stl2::invoke(proj, *--last))) {
+						;
+					}
+					while (!__stl2::invoke(comp, p, __stl2::invoke(proj, *++first))) {
+						;
+					}
+				}
+
+				*begin = __stl2::iter_move(last);
+				*last = std::move(pivot);
+				return last;
+			}
+
+			///////////////////////////////////////////////////////////////////
+			// Branchless block partitioning
+			//
+			// Derived from "BlockQuicksort: How Branch Mispredictions don't
+			// affect Quicksort" by Stefan Edelkamp and Armin Weiss. Comparison
+			// outcomes are recorded into small offset buffers without
+			// branching, and the misplaced elements are then swapped in
+			// batches. This pays off only when comparisons are cheap and their
+			// outcomes unpredictable, so it's restricted to arithmetic keys
+			// ordered by one of the standard comparison function objects.
+			//
+			template<class>
+			constexpr bool is_branchless_comparison = false;
+			template<class T>
+			constexpr bool is_branchless_comparison<less<T>> = true;
+			template<class T>
+			constexpr bool is_branchless_comparison<greater<T>> = true;
+			template<class T>
+			constexpr bool is_branchless_comparison<std::less<T>> = true;
+			template<class T>
+			constexpr bool is_branchless_comparison<std::greater<T>> = true;
+			template<class T>
+			constexpr bool is_branchless_comparison<std::reference_wrapper<T>> =
+				is_branchless_comparison<std::remove_cv_t<T>>;
+
+			template<class I, class Comp, class Proj>
+			concept bool BranchlessSortable =
+				RandomAccessIterator<I> && Sortable<I, Comp, Proj> &&
+				is_branchless_comparison<Comp> &&
+				_Is<__uncvref<indirect_result_t<Proj&, I>>, std::is_arithmetic>;
+
+			// Number of elements examined per offset buffer fill.
+			constexpr std::ptrdiff_t block_size = 64;
+			static_assert(block_size <= 256, "offsets must fit in an unsigned char");
+
+			// Swaps the num element pairs identified by the offset buffers.
+			template<RandomAccessIterator I>
+			requires
+				Permutable<I>
+			void swap_offsets(I first, I last,
+				const unsigned char* offsets_l, const unsigned char* offsets_r,
+				std::ptrdiff_t num, bool use_swaps)
+			{
+				if (use_swaps) {
+					// Descending inputs need pairwise swaps to stay O(N).
+					for (std::ptrdiff_t i = 0; i < num; ++i) {
+						__stl2::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+					}
+				} else if (num > 0) {
+					// Otherwise, a cyclic permutation needs fewer moves.
+					I l = first + offsets_l[0];
+					I r = last - offsets_r[0];
+					iter_value_t<I> tmp = __stl2::iter_move(l);
+					*l = __stl2::iter_move(r);
+					for (std::ptrdiff_t i = 1; i < num; ++i) {
+						l = first + offsets_l[i];
+						*r = __stl2::iter_move(l);
+						r = last - offsets_r[i];
+						*l = __stl2::iter_move(r);
 					}
-					I cut = rsort::unguarded_partition(first, last, comp, proj);
-					rsort::introsort_loop(cut, last, --depth_limit, comp, proj);
-					last = cut;
+					*r = std::move(tmp);
 				}
 			}
 
+			// As partition_right, but without data-dependent branches in the
+			// inner loop.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				BranchlessSortable<I, Comp, Proj>
+			std::pair<I, bool>
+			partition_right_branchless(I first, I last, Comp& comp, Proj& proj)
+			{
+				iter_value_t<I> pivot = __stl2::iter_move(first);
+				auto&& p = __stl2::invoke(proj, pivot);
+				I begin = first;
+
+				while (__stl2::invoke(comp, __stl2::invoke(proj, *++first), p)) {
+					;
+				}
+				if (first - 1 == begin) {
+					while (first < last && !__stl2::invoke(comp, __stl2::invoke(proj, *--last), p)) {
+						;
+					}
+				} else {
+					while (!__stl2::invoke(comp, __stl2::invoke(proj, *--last), p)) {
+						;
+					}
+				}
+
+				bool already_partitioned = first >= last;
+				if (!already_partitioned) {
+					__stl2::iter_swap(first, last);
+					++first;
+
+					alignas(64) unsigned char offsets_l[block_size];
+					alignas(64) unsigned char offsets_r[block_size];
+					I offsets_l_base = first;
+					I offsets_r_base = last;
+					std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+					while (first < last) {
+						// Decide how many unknown elements to examine on each side.
+						std::ptrdiff_t num_unknown = last - first;
+						std::ptrdiff_t left_split =
+							num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+						std::ptrdiff_t right_split =
+							num_r == 0 ? (num_unknown - left_split) : 0;
+
+						// Record the offsets of elements on the wrong side.
+						left_split = left_split < block_size ? left_split : block_size;
+						for (std::ptrdiff_t i = 0; i < left_split; ++i) {
+							offsets_l[num_l] = static_cast<unsigned char>(i);
+							num_l += !__stl2::invoke(comp, __stl2::invoke(proj, *first), p);
+							++first;
+						}
+						right_split = right_split < block_size ? right_split : block_size;
+						for (std::ptrdiff_t i = 0; i < right_split; ++i) {
+							offsets_r[num_r] = static_cast<unsigned char>(i + 1);
+							num_r += __stl2::invoke(comp, __stl2::invoke(proj, *--last), p);
+						}
+
+						// Swap as many misplaced pairs as we've found.
+						std::ptrdiff_t num = num_l < num_r ? num_l : num_r;
+						rsort::swap_offsets(offsets_l_base, offsets_r_base,
+							offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+						num_l -= num;
+						num_r -= num;
+						start_l += num;
+						start_r += num;
+						if (num_l == 0) {
+							start_l = 0;
+							offsets_l_base = first;
+						}
+						if (num_r == 0) {
+							start_r = 0;
+							offsets_r_base = last;
+						}
+					}
+
+					// [first, last) is now empty; move the remaining misplaced
+					// elements from one side to the boundary.
+					if (num_l) {
+						while (num_l--) {
+							__stl2::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+						}
+						first = last;
+					}
+					if (num_r) {
+						while (num_r--) {
+							__stl2::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+							++first;
+						}
+						last = first;
+					}
+				}
+
+				I pivot_pos = first - 1;
+				*begin = __stl2::iter_move(pivot_pos);
+				*pivot_pos = std::move(pivot);
+				return {pivot_pos, already_partitioned};
+			}
+
 			template<RandomAccessIterator I, class Comp, class Proj>
 			requires
 				Sortable<I, Comp, Proj>
-			void final_insertion_sort(I first, I last, Comp &comp, Proj &proj)
+			std::pair<I, bool>
+			partition_right_any(I first, I last, Comp& comp, Proj& proj)
 			{
-				if (__stl2::distance(first, last) > introsort_threshold) {
-					rsort::insertion_sort(first, first + introsort_threshold, comp, proj);
-					rsort::unguarded_insertion_sort(first + introsort_threshold, last, comp, proj);
+				if constexpr (BranchlessSortable<I, Comp, Proj>) {
+					return rsort::partition_right_branchless(first, last, comp, proj);
 				} else {
-					rsort::insertion_sort(first, last, comp, proj);
+					return rsort::partition_right(first, last, comp, proj);
+				}
+			}
+
+			// Swaps a few elements into new positions to break up patterns
+			// that produced a highly unbalanced partition of [first, last).
+			template<RandomAccessIterator I>
+			requires
+				Permutable<I>
+			void break_patterns(I first, I last)
+			{
+				auto const n = iter_difference_t<I>(last - first);
+				if (n >= insertion_sort_threshold) {
+					auto const q = n / 4;
+					__stl2::iter_swap(first, first + q);
+					__stl2::iter_swap(last - 1, last - q);
+					if (n > ninther_threshold) {
+						__stl2::iter_swap(first + 1, first + (q + 1));
+						__stl2::iter_swap(first + 2, first + (q + 2));
+						__stl2::iter_swap(last - 2, last - (q + 1));
+						__stl2::iter_swap(last - 3, last - (q + 2));
+					}
+				}
+			}
+
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			void pdqsort_loop(I first, I last, iter_difference_t<I> bad_allowed,
+				bool leftmost, Comp& comp, Proj& proj)
+			{
+				// Loop on the right partition to bound stack depth.
+				while (true) {
+					auto const n = iter_difference_t<I>(last - first);
+
+					if (n < insertion_sort_threshold) {
+						if (leftmost) {
+							rsort::insertion_sort(first, last, comp, proj);
+						} else {
+							rsort::unguarded_insertion_sort(first, last, comp, proj);
+						}
+						return;
+					}
+
+					rsort::choose_pivot(first, last, comp, proj);
+
+					// No element of [first, last) is less than *prev(first) when
+					// this isn't the leftmost partition. If the pivot is equivalent
+					// to *prev(first), partition out the elements equivalent to it:
+					// they are already in their final positions.
+					if (!leftmost &&
+						!__stl2::invoke(comp, __stl2::invoke(proj, *(first - 1)), __stl2::invoke(proj, *first))) {
+						first = rsort::partition_left(first, last, comp, proj) + 1;
+						continue;
+					}
+
+					auto [pivot_pos, already_partitioned] =
+						rsort::partition_right_any(first, last, comp, proj);
+
+					auto const l_size = iter_difference_t<I>(pivot_pos - first);
+					auto const r_size = iter_difference_t<I>(last - (pivot_pos + 1));
+					if (l_size < n / 8 || r_size < n / 8) {
+						// Highly unbalanced partition: if this keeps happening,
+						// switch to heapsort to guarantee O(N log N).
+						if (--bad_allowed == 0) {
+							detail::make_heap_n(first, n, std::ref(comp), std::ref(proj));
+							detail::sort_heap_n(first, n, std::ref(comp), std::ref(proj));
+							return;
+						}
+						rsort::break_patterns(first, pivot_pos);
+						rsort::break_patterns(pivot_pos + 1, last);
+					} else if (already_partitioned &&
+						rsort::partial_insertion_sort(first, pivot_pos, comp, proj) &&
+						rsort::partial_insertion_sort(pivot_pos + 1, last, comp, proj)) {
+						// The input was (nearly) sorted.
+						return;
+					}
+
+					rsort::pdqsort_loop(first, pivot_pos, bad_allowed, leftmost, comp, proj);
+					first = pivot_pos + 1;
+					leftmost = false;
+				}
+			}
+
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			void pdqsort(I first, I last, Comp& comp, Proj& proj)
+			{
+				if (first != last) {
+					rsort::pdqsort_loop(first, last, rsort::log2(last - first),
+						true, comp, proj);
+				}
+			}
+
+			// Pattern-defeating quickselect: permutes [first, last) so that
+			// *nth is the element that would be there if the range were
+			// sorted, [first, nth) is not greater than *nth, and (nth, last)
+			// is not less than *nth.
+			template<RandomAccessIterator I, class Comp, class Proj>
+			requires
+				Sortable<I, Comp, Proj>
+			void pdqselect(I first, I nth, I last, Comp& comp, Proj& proj)
+			{
+				if (first == last || nth == last) {
+					return;
+				}
+				auto bad_allowed = rsort::log2(last - first);
+				bool leftmost = true;
+				while (true) {
+					auto const n = iter_difference_t<I>(last - first);
+
+					if (n < insertion_sort_threshold) {
+						if (leftmost) {
+							rsort::insertion_sort(first, last, comp, proj);
+						} else {
+							rsort::unguarded_insertion_sort(first, last, comp, proj);
+						}
+						return;
+					}
+
+					rsort::choose_pivot(first, last, comp, proj);
+
+					if (!leftmost &&
+						!__stl2::invoke(comp, __stl2::invoke(proj, *(first - 1)), __stl2::invoke(proj, *first))) {
+						I pivot_pos = rsort::partition_left(first, last, comp, proj);
+						if (nth <= pivot_pos) {
+							return;
+						}
+						first = pivot_pos + 1;
+						continue;
+					}
+
+					I pivot_pos = rsort::partition_right_any(first, last, comp, proj).first;
+					if (pivot_pos == nth) {
+						return;
+					}
+
+					auto const l_size = iter_difference_t<I>(pivot_pos - first);
+					auto const r_size = iter_difference_t<I>(last - (pivot_pos + 1));
+					if (l_size < n / 8 || r_size < n / 8) {
+						if (--bad_allowed == 0) {
+							detail::make_heap_n(first, n, std::ref(comp), std::ref(proj));
+							detail::sort_heap_n(first, n, std::ref(comp), std::ref(proj));
+							return;
+						}
+						rsort::break_patterns(first, pivot_pos);
+						rsort::break_patterns(pivot_pos + 1, last);
+					}
+
+					if (nth < pivot_pos) {
+						last = pivot_pos;
+					} else {
+						first = pivot_pos + 1;
+						leftmost = false;
+					}
 				}
 			}
 		}
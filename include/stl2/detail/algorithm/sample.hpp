@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <cmath>
+#include <limits>
 #include <stl2/iterator.hpp>
 #include <stl2/random.hpp>
 #include <stl2/detail/fwd.hpp>
@@ -30,25 +32,51 @@ STL2_OPEN_NAMESPACE {
 			UniformRandomNumberGenerator<remove_reference_t<Gen>> &&
 			ConvertibleTo<result_of_t<Gen&()>, iter_difference_t<I>>;
 
+		// Selects n of the pop_size elements of [first, last) in order,
+		// by Vitter's Method A: each gap between selected elements is
+		// drawn with a single random number. That is n random numbers in
+		// all rather than one per element, and with random-access
+		// iterators the gaps are skipped in constant time.
 		template<class I, class S, class O, class Gen>
 		requires
 			constraint<I, S, O, Gen>
 		tagged_pair<tag::in(I), tag::out(O)>
-		sized_impl(I first, S last, iter_difference_t<I> pop_size,
+		sized_impl(I first, S, iter_difference_t<I> pop_size,
 			O out, iter_difference_t<I> n, Gen& gen)
 		{
-			uniform_int_distribution<iter_difference_t<I>> dist;
-			using param_t = typename decltype(dist)::param_type;
+			using D = iter_difference_t<I>;
 			if (n > pop_size) {
 				n = pop_size;
 			}
-			for (; n > 0 && first != last; ++first) {
-				if (dist(gen, param_t{0, --pop_size}) < n) {
-					--n;
-					*out = *first;
-					++out;
+			if (n <= 0) {
+				return {std::move(first), std::move(out)};
+			}
+			auto select = [&](D skip) {
+				__stl2::advance(first, skip);
+				*out = *first;
+				++out;
+				++first;
+			};
+			// top is the number of elements left unselected, remaining the
+			// number not yet passed over.
+			auto top = static_cast<double>(pop_size - n);
+			auto remaining = static_cast<double>(pop_size);
+			for (; n > 1; --n) {
+				auto const v = detail::random::unit_open(gen);
+				D skip = 0;
+				// quot is the probability that the next skip+1 elements
+				// are all passed over.
+				for (auto quot = top / remaining; quot > v; quot *= top / remaining) {
+					++skip;
+					top -= 1;
+					remaining -= 1;
 				}
+				select(skip);
+				remaining -= 1;
 			}
+			auto const r = static_cast<D>(remaining);
+			auto const skip = static_cast<D>(remaining * detail::random::unit_open(gen));
+			select(skip < r ? skip : r - 1);
 			return {std::move(first), std::move(out)};
 		}
 	}
@@ -85,12 +113,31 @@ STL2_OPEN_NAMESPACE {
 			}
 			out[i] = *first;
 		}
-		uniform_int_distribution<iter_difference_t<I>> dist;
-		using param_t = typename decltype(dist)::param_type;
-		for (auto pop_size = n; first != last; (void)++first, ++pop_size) {
-			auto const i = dist(gen, param_t{0, pop_size});
-			if (i < n) {
-				out[i] = *first;
+		{
+			// Li's Algorithm L: with w the largest of n uniform keys, the
+			// number of elements to pass over before the next one enters
+			// the reservoir is geometric with parameter w, so the
+			// reservoir is updated O(n log(N / n)) times for a stream of
+			// N elements and the elements passed over draw no random
+			// numbers.
+			using D = iter_difference_t<I>;
+			auto const k = static_cast<double>(n);
+			auto const next_w = [&] {
+				return std::exp(std::log(detail::random::unit_open(gen)) / k);
+			};
+			auto w = next_w();
+			for (;;) {
+				auto const skip = std::floor(
+					std::log(detail::random::unit_open(gen)) / std::log1p(-w));
+				constexpr auto max = std::numeric_limits<D>::max();
+				if (__stl2::advance(first, skip < static_cast<double>(max) ?
+					static_cast<D>(skip) : max, last) != 0 || first == last)
+				{
+					break;
+				}
+				out[detail::random::uniform_below(gen, n)] = *first;
+				++first;
+				w *= next_w();
 			}
 		}
 		out += n;
@@ -13,17 +13,171 @@
 #ifndef STL2_DETAIL_ALGORITHM_SHUFFLE_HPP
 #define STL2_DETAIL_ALGORITHM_SHUFFLE_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 #include <stl2/iterator.hpp>
 #include <stl2/random.hpp>
+#include <stl2/detail/construct_destruct.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/randutils.hpp>
+#include <stl2/detail/temporary_vector.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // shuffle [alg.random.shuffle]
 //
 STL2_OPEN_NAMESPACE {
+	namespace detail {
+		namespace rshuffle {
+			// Fisher-Yates over [first, first + n). With a generator that
+			// yields full words, the swap indices for two consecutive
+			// positions come from a single bounded2 draw while their
+			// product fits in 64 bits.
+			template<RandomAccessIterator I, UniformRandomNumberGenerator G>
+			requires Permutable<I>
+			void fisher_yates(I first, iter_difference_t<I> n, G& g) {
+				using D = iter_difference_t<I>;
+				using U = std::uint64_t;
+				D k = 1;
+				if constexpr (random::FullWordGenerator<G>) {
+					for (; k + 1 < n && static_cast<U>(k) < (U{1} << 32) - 1; k += 2) {
+						auto const [i, j] = random::bounded2(g, static_cast<U>(k) + 1, static_cast<U>(k) + 2);
+						if (static_cast<D>(i) != k) {
+							__stl2::iter_swap(first + static_cast<D>(i), first + k);
+						}
+						if (static_cast<D>(j) != k + 1) {
+							__stl2::iter_swap(first + static_cast<D>(j), first + (k + 1));
+						}
+					}
+				}
+				for (; k < n; ++k) {
+					auto const i = random::uniform_below(g, k + 1);
+					if (i != k) {
+						__stl2::iter_swap(first + i, first + k);
+					}
+				}
+			}
+
+			// Bytes of elements per bucket of scatter_shuffle, so that
+			// each bucket is shuffled within the cache.
+			constexpr std::size_t bucket_bytes = std::size_t{1} << 18;
+			constexpr std::ptrdiff_t max_buckets = 1 << 12;
+
+			template<class I>
+			concept bool Scatterable =
+				RandomAccessIterator<I> && Permutable<I> &&
+				Constructible<iter_value_t<I>, iter_rvalue_reference_t<I>>;
+
+			// Shuffles [first, first + n) by scattering each element to one
+			// of the given number of buckets, chosen uniformly at random,
+			// then shuffling each bucket (Rao; Sandelius). Every permutation
+			// is equally likely, since each is the concatenation of exactly
+			// one assignment to buckets and one arrangement of each
+			// bucket. The scatter writes to one cache line per bucket at a
+			// time, and each bucket fits in cache, unlike the random
+			// accesses of Fisher-Yates over a large range. Chunks of the
+			// range and then buckets are processed in parallel, each with
+			// its own engine seeded from g. Returns false without modifying
+			// the range if no buffer for the n elements can be obtained.
+			template<Scatterable I, class Gen>
+			bool scatter_shuffle(I first, iter_difference_t<I> n_, Gen& g,
+				std::ptrdiff_t buckets)
+			{
+				STL2_EXPECT(buckets > 0);
+				using T = iter_value_t<I>;
+				auto const n = static_cast<std::ptrdiff_t>(n_);
+				temporary_buffer<T> buf{n};
+				if (buf.size() < n) {
+					return false;
+				}
+				T* const scratch = buf.data();
+				auto const chunks = std::max(detail::parallel_chunks(n), std::ptrdiff_t{1});
+
+				std::vector<std::uint64_t> seeds(chunks + buckets);
+				uniform_int_distribution<std::uint64_t> dist{};
+				for (auto& seed : seeds) {
+					seed = dist(g);
+				}
+				auto const chunk_bucket = [&](auto& engine) {
+					return random::uniform_below(engine, buckets);
+				};
+
+				// Count the elements each chunk sends to each bucket...
+				std::vector<std::ptrdiff_t> offsets(chunks * buckets);
+				auto count_body = [&](std::ptrdiff_t c) {
+					default_random_engine engine{seeds[c]};
+					auto* const count = offsets.data() + c * buckets;
+					for (auto i = detail::chunk_begin(n, chunks, c),
+						hi = detail::chunk_begin(n, chunks, c + 1); i < hi; ++i)
+					{
+						++count[chunk_bucket(engine)];
+					}
+				};
+				thread_pool::global().bulk(chunks, count_body);
+
+				// ...lay the buckets out in order, each chunk's share of a
+				// bucket after those of the chunks before it...
+				std::vector<std::ptrdiff_t> bounds(buckets + 1);
+				std::ptrdiff_t total = 0;
+				for (std::ptrdiff_t b = 0; b < buckets; ++b) {
+					bounds[b] = total;
+					for (std::ptrdiff_t c = 0; c < chunks; ++c) {
+						auto& slot = offsets[c * buckets + b];
+						auto const count = slot;
+						slot = total;
+						total += count;
+					}
+				}
+				bounds[buckets] = total;
+
+				// ...then repeat each chunk's draws to scatter its elements.
+				auto scatter_body = [&](std::ptrdiff_t c) {
+					default_random_engine engine{seeds[c]};
+					auto* const offset = offsets.data() + c * buckets;
+					for (auto i = detail::chunk_begin(n, chunks, c),
+						hi = detail::chunk_begin(n, chunks, c + 1); i < hi; ++i)
+					{
+						detail::construct(scratch[offset[chunk_bucket(engine)]++],
+							__stl2::iter_move(first + i));
+					}
+				};
+				thread_pool::global().bulk(chunks, scatter_body);
+
+				auto shuffle_body = [&](std::ptrdiff_t b) {
+					default_random_engine engine{seeds[chunks + b]};
+					auto const lo = bounds[b], hi = bounds[b + 1];
+					rshuffle::fisher_yates(scratch + lo, hi - lo, engine);
+					for (auto i = lo; i < hi; ++i) {
+						*(first + i) = __stl2::iter_move(scratch + i);
+						detail::destruct(scratch[i]);
+					}
+				};
+				thread_pool::global().bulk(buckets, shuffle_body);
+				return true;
+			}
+
+			// Shuffles [first, first + n) with scatter_shuffle if it is
+			// larger than a single bucket. Returns false if it does not.
+			template<RandomAccessIterator I, class Gen>
+			requires Permutable<I>
+			bool parallel_shuffle(I first, iter_difference_t<I> n, Gen& g) {
+				if constexpr (Scatterable<I>) {
+					constexpr auto bucket_size = static_cast<std::ptrdiff_t>(
+						std::max(bucket_bytes / sizeof(iter_value_t<I>), std::size_t{1}));
+					auto const buckets = std::min(
+						static_cast<std::ptrdiff_t>(n) / bucket_size, max_buckets);
+					if (buckets >= 2) {
+						return rshuffle::scatter_shuffle(first, n, g, buckets);
+					}
+				}
+				return false;
+			}
+		}
+	}
+
 	template<RandomAccessIterator I, Sentinel<I> S,
 		class Gen = detail::default_random_engine&, class D = iter_difference_t<I>>
 	requires
@@ -36,6 +190,11 @@ STL2_OPEN_NAMESPACE {
 		if (mid == last) {
 			return mid;
 		}
+		if constexpr (detail::random::FullWordGenerator<remove_reference_t<Gen>>) {
+			auto const n = __stl2::distance(first, std::move(last));
+			detail::rshuffle::fisher_yates(first, n, g);
+			return first + n;
+		}
 		auto dist = uniform_int_distribution<D>{};
 		using param_t = typename uniform_int_distribution<D>::param_type;
 		while (++mid != last) {
@@ -58,6 +217,35 @@ STL2_OPEN_NAMESPACE {
 		return  __stl2::shuffle(__stl2::begin(rng), __stl2::end(rng),
 			std::forward<Gen>(g));
 	}
+
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, RandomAccessIterator I, Sentinel<I> S,
+		class Gen = detail::default_random_engine&>
+	requires
+		Permutable<I> &&
+		UniformRandomNumberGenerator<remove_reference_t<Gen>>
+	I shuffle(E&&, I first, S last_, Gen&& g = detail::get_random_engine())
+	{
+		auto last = __stl2::next(first, std::move(last_));
+		if constexpr (ext::ParallelPolicy<E>) {
+			if (detail::rshuffle::parallel_shuffle(first, last - first, g)) {
+				return last;
+			}
+		}
+		return __stl2::shuffle(first, last, g);
+	}
+
+	template<ext::ExecutionPolicy E, RandomAccessRange Rng,
+		class Gen = detail::default_random_engine&>
+	requires
+		Permutable<iterator_t<Rng>> &&
+		UniformRandomNumberGenerator<remove_reference_t<Gen>>
+	safe_iterator_t<Rng> shuffle(E&& exec, Rng&& rng,
+		Gen&& g = detail::get_random_engine())
+	{
+		return __stl2::shuffle(std::forward<E>(exec),
+			__stl2::begin(rng), __stl2::end(rng), g);
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
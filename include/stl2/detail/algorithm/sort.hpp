@@ -18,6 +18,7 @@
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
 #include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -30,13 +31,8 @@ STL2_OPEN_NAMESPACE {
 		Sortable<I, Comp, Proj>
 	I sort(I first, S sent, Comp comp = Comp{}, Proj proj = Proj{})
 	{
-		if (first == sent) {
-			return first;
-		}
 		auto last = __stl2::next(first, std::move(sent));
-		auto n = __stl2::distance(first, last);
-		detail::rsort::introsort_loop(first, last, detail::rsort::log2(n) * 2, comp, proj);
-		detail::rsort::final_insertion_sort(first, last, comp, proj);
+		detail::rsort::pdqsort(first, last, comp, proj);
 		return last;
 	}
 
@@ -49,6 +45,33 @@ STL2_OPEN_NAMESPACE {
 			std::ref(comp), std::ref(proj));
 	}
 
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, RandomAccessIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		Sortable<I, Comp, Proj>
+	I sort(E&&, I first, S sent, Comp comp = Comp{}, Proj proj = Proj{})
+	{
+		auto last = __stl2::next(first, std::move(sent));
+		if constexpr (ext::ParallelPolicy<E>) {
+			if (detail::ssort::parallel_merge_sort(first, last, comp, proj)) {
+				return last;
+			}
+		}
+		detail::rsort::pdqsort(first, last, comp, proj);
+		return last;
+	}
+
+	template<ext::ExecutionPolicy E, RandomAccessRange Rng,
+		class Comp = less<>, class Proj = identity>
+	requires
+		Sortable<iterator_t<Rng>, Comp, Proj>
+	safe_iterator_t<Rng> sort(E&& exec, Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{})
+	{
+		return __stl2::sort(std::forward<E>(exec), __stl2::begin(rng), __stl2::end(rng),
+			std::ref(comp), std::ref(proj));
+	}
+
 	namespace ext {
 #if STL2_WORKAROUND_GCC_79591
 		template<RandomAccessIterator I, Sentinel<I> S, class Comp = less<>,
@@ -57,13 +80,8 @@ STL2_OPEN_NAMESPACE {
 			Sortable<I, Comp, Proj>
 		I sort(I first, S sent, Comp comp = Comp{}, Proj proj = Proj{})
 		{
-			if (first == sent) {
-				return first;
-			}
 			auto last = __stl2::next(first, std::move(sent));
-			auto n = __stl2::distance(first, last);
-			detail::rsort::introsort_loop(first, last, detail::rsort::log2(n) * 2, comp, proj);
-			detail::rsort::final_insertion_sort(first, last, comp, proj);
+			detail::rsort::pdqsort(first, last, comp, proj);
 			return last;
 		}
 
@@ -35,8 +35,10 @@
 #ifndef STL2_DETAIL_ALGORITHM_STABLE_SORT_HPP
 #define STL2_DETAIL_ALGORITHM_STABLE_SORT_HPP
 
+#include <vector>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
+#include <stl2/detail/construct_destruct.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
 #include <stl2/detail/algorithm/inplace_merge.hpp>
@@ -44,6 +46,7 @@
 #include <stl2/detail/algorithm/min.hpp>
 #include <stl2/detail/algorithm/random_access_sort.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // stable_sort [stable.sort]
@@ -156,6 +159,179 @@ STL2_OPEN_NAMESPACE {
 					middle - first, last - middle, buf,
 					std::ref(comp), std::ref(proj));
 			}
+
+			///////////////////////////////////////////////////////////////////
+			// Parallel merge sort
+			//
+			// The range is cut into one run per pool thread, and each run is
+			// merge sorted independently using the corresponding slice of a
+			// single temporary buffer as scratch. Adjacent runs are then
+			// merged pairwise, ping-ponging between the range and the
+			// buffer, until one run remains. Every pairwise merge is split
+			// at merge-path co-ranks into independent pieces so that all
+			// threads stay busy even in the final rounds.
+			//
+			// Below this many elements per run, parallelism doesn't pay.
+			constexpr std::ptrdiff_t parallel_sort_grain = 1 << 13;
+
+			// Sorts [first, last) into the range of equal length at out,
+			// whose elements are used as temporary storage.
+			template<RandomAccessIterator I, RandomAccessIterator O, class C, class P>
+			requires
+				Sortable<I, C, P> && Sortable<O, C, P>
+			void sort_run(I first, I last, O out, C& comp, P& proj)
+			{
+				auto const len = iter_difference_t<I>(last - first);
+				auto step_size = iter_difference_t<I>(merge_sort_chunk_size);
+				ssort::chunk_insertion_sort(first, last, step_size, comp, proj);
+				bool in_out = false;
+				for (; step_size < len; step_size *= 2) {
+					if (in_out) {
+						ssort::merge_sort_loop(out, out + len, first, step_size, comp, proj);
+					} else {
+						ssort::merge_sort_loop(first, last, out, step_size, comp, proj);
+					}
+					in_out = !in_out;
+				}
+				if (!in_out) {
+					__stl2::move(first, last, out);
+				}
+			}
+
+			// The number of elements from [a, a + m) among the first d
+			// elements of the stable merge of [a, a + m) and [b, b + l).
+			template<RandomAccessIterator I, class C, class P>
+			std::ptrdiff_t co_rank(std::ptrdiff_t d, I a, std::ptrdiff_t m,
+				I b, std::ptrdiff_t l, C& comp, P& proj)
+			{
+				auto lo = d > l ? d - l : std::ptrdiff_t{0};
+				auto hi = d < m ? d : m;
+				while (lo < hi) {
+					auto const mid = lo + (hi - lo) / 2;
+					// Does a[mid] precede b[d - mid - 1] in the merge?
+					if (!__stl2::invoke(comp, __stl2::invoke(proj, b[d - mid - 1]),
+						__stl2::invoke(proj, a[mid])))
+					{
+						lo = mid + 1;
+					} else {
+						hi = mid;
+					}
+				}
+				return lo;
+			}
+
+			// Merges each even-numbered run of src described by bounds with
+			// its successor into the same position of dst, and updates bounds
+			// to describe the merged runs.
+			template<RandomAccessIterator I, RandomAccessIterator O, class C, class P>
+			requires
+				Sortable<I, C, P> && IndirectlyMovable<I, O>
+			void parallel_merge_round(I src, O dst, std::vector<std::ptrdiff_t>& bounds,
+				C& comp, P& proj)
+			{
+				struct piece {
+					std::ptrdiff_t lo, mid, hi; // the two runs [lo, mid) and [mid, hi)
+					std::ptrdiff_t d_lo, d_hi;  // the piece [d_lo, d_hi) of their merge
+				};
+				auto const n = bounds.back();
+				auto const pieces_per_n = detail::parallel_chunks(n);
+				std::vector<piece> pieces;
+				std::vector<std::ptrdiff_t> merged;
+				for (std::size_t r = 0; r + 1 < bounds.size(); r += 2) {
+					auto const lo = bounds[r];
+					auto const mid = bounds[r + 1];
+					auto const hi = r + 2 < bounds.size() ? bounds[r + 2] : mid;
+					auto const len = hi - lo;
+					auto const k = len * pieces_per_n / n;
+					if (k <= 1) {
+						pieces.push_back({lo, mid, hi, 0, len});
+					} else {
+						for (std::ptrdiff_t i = 0; i < k; ++i) {
+							pieces.push_back({lo, mid, hi,
+								detail::chunk_begin(len, k, i), detail::chunk_begin(len, k, i + 1)});
+						}
+					}
+					merged.push_back(lo);
+				}
+				merged.push_back(n);
+				bounds = std::move(merged);
+
+				auto body = [&](std::ptrdiff_t i) {
+					auto const& p = pieces[i];
+					auto const a = src + p.lo, b = src + p.mid;
+					auto const m = p.mid - p.lo, l = p.hi - p.mid;
+					auto const i0 = ssort::co_rank(p.d_lo, a, m, b, l, comp, proj);
+					auto const i1 = ssort::co_rank(p.d_hi, a, m, b, l, comp, proj);
+					__stl2::merge(
+						__stl2::make_move_iterator(a + i0),
+						__stl2::make_move_iterator(a + i1),
+						__stl2::make_move_iterator(b + (p.d_lo - i0)),
+						__stl2::make_move_iterator(b + (p.d_hi - i1)),
+						dst + (p.lo + p.d_lo), std::ref(comp),
+						std::ref(proj), std::ref(proj));
+				};
+				thread_pool::global().bulk(static_cast<std::ptrdiff_t>(pieces.size()), body);
+			}
+
+			// Stably sorts [first, last) in parallel. Returns false without
+			// modifying the range if the range is too small to benefit or
+			// no buffer can be obtained; the caller then sorts sequentially.
+			template<RandomAccessIterator I, class C, class P>
+			requires
+				Sortable<I, C, P>
+			bool parallel_merge_sort(I first, I last, C& comp, P& proj)
+			{
+				auto const n = static_cast<std::ptrdiff_t>(last - first);
+				auto runs = n / parallel_sort_grain;
+				if (runs > thread_pool::global().concurrency()) {
+					runs = thread_pool::global().concurrency();
+				}
+				if (runs < 2) {
+					return false;
+				}
+				using T = iter_value_t<I>;
+				temporary_buffer<T> buf{n};
+				if (buf.size() < n) {
+					return false;
+				}
+				T* const scratch = buf.data();
+
+				std::vector<std::ptrdiff_t> bounds(runs + 1);
+				for (std::ptrdiff_t r = 0; r <= runs; ++r) {
+					bounds[r] = detail::chunk_begin(n, runs, r);
+				}
+
+				// Construct the buffer from the runs, and sort each run from
+				// the buffer back into the range.
+				auto sort_body = [&](std::ptrdiff_t r) {
+					auto const lo = bounds[r], hi = bounds[r + 1];
+					for (auto i = lo; i < hi; ++i) {
+						detail::construct(scratch[i], __stl2::iter_move(first + i));
+					}
+					ssort::sort_run(scratch + lo, scratch + hi, first + lo, comp, proj);
+				};
+				thread_pool::global().bulk(runs, sort_body);
+
+				bool in_scratch = false;
+				while (bounds.size() > 2) {
+					if (in_scratch) {
+						ssort::parallel_merge_round(scratch, first, bounds, comp, proj);
+					} else {
+						ssort::parallel_merge_round(first, scratch, bounds, comp, proj);
+					}
+					in_scratch = !in_scratch;
+				}
+
+				detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+					if (in_scratch) {
+						__stl2::move(scratch + lo, scratch + hi, first + lo);
+					}
+					for (auto i = lo; i < hi; ++i) {
+						detail::destruct(scratch[i]);
+					}
+				});
+				return true;
+			}
 		}
 	}
 
@@ -190,6 +366,34 @@ STL2_OPEN_NAMESPACE {
 		return last;
 	}
 
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, RandomAccessIterator I, Sentinel<I> S,
+		class Comp = less<>, class Proj = identity>
+	requires
+		Sortable<I, Comp, Proj>
+	I stable_sort(E&&, I first, S last_, Comp comp = Comp{}, Proj proj = Proj{})
+	{
+		auto last = __stl2::next(first, std::move(last_));
+		if constexpr (ext::ParallelPolicy<E>) {
+			if (detail::ssort::parallel_merge_sort(first, last, comp, proj)) {
+				return last;
+			}
+		}
+		return __stl2::stable_sort(first, last, std::ref(comp), std::ref(proj));
+	}
+
+	template<ext::ExecutionPolicy E, RandomAccessRange Rng,
+		class Comp = less<>, class Proj = identity>
+	requires
+		Sortable<iterator_t<Rng>, Comp, Proj>
+	safe_iterator_t<Rng>
+	stable_sort(E&& exec, Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{})
+	{
+		return __stl2::stable_sort(std::forward<E>(exec),
+			__stl2::begin(rng), __stl2::end(rng),
+			std::ref(comp), std::ref(proj));
+	}
+
 	// Extension: supports forward ranges.
 	template<ForwardRange Rng, class Comp = less<>, class Proj = identity>
 	requires
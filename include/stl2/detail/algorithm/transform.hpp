@@ -20,6 +20,7 @@
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/execution/parallel.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // transform [alg.transform]
@@ -132,6 +133,95 @@ STL2_OPEN_NAMESPACE {
 			std::ref(proj1),
 			std::ref(proj2));
 	}
+
+	// Extension: execution policies
+	template<ext::ExecutionPolicy E, ForwardIterator I, Sentinel<I> S, WeaklyIncrementable O,
+		CopyConstructible F, class Proj = identity>
+	requires
+		Writable<O,
+			indirect_result_t<F&, projected<I, Proj>>>
+	tagged_pair<tag::in(I), tag::out(O)>
+	transform(E&&, I first, S last, O result, F op, Proj proj = Proj{})
+	{
+		if constexpr (detail::Parallelizable<E, I, S> && RandomAccessIterator<O>) {
+			auto const n = static_cast<std::ptrdiff_t>(last - first);
+			detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+				__stl2::transform(first + lo, first + hi, result + lo,
+					std::ref(op), std::ref(proj));
+			});
+			return {first + n, result + n};
+		} else {
+			return __stl2::transform(std::move(first), std::move(last),
+				std::move(result), std::ref(op), std::ref(proj));
+		}
+	}
+
+	template<ext::ExecutionPolicy E, ForwardRange R, WeaklyIncrementable O,
+		CopyConstructible F, class Proj = identity>
+	requires
+		Writable<O,
+			indirect_result_t<F&, projected<iterator_t<R>, Proj>>>
+	tagged_pair<tag::in(safe_iterator_t<R>), tag::out(O)>
+	transform(E&& exec, R&& r, O result, F op, Proj proj = Proj{})
+	{
+		return __stl2::transform(std::forward<E>(exec),
+			__stl2::begin(r), __stl2::end(r), std::move(result),
+			std::ref(op), std::ref(proj));
+	}
+
+	template<ext::ExecutionPolicy E, ForwardIterator I1, Sentinel<I1> S1,
+		ForwardIterator I2, Sentinel<I2> S2,
+		WeaklyIncrementable O, CopyConstructible F,
+		class Proj1 = identity, class Proj2 = identity>
+	requires
+		Writable<O,
+			indirect_result_t<F&,
+				projected<I1, Proj1>,
+				projected<I2, Proj2>>>
+	tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+	transform(E&&, I1 first1, S1 last1, I2 first2, S2 last2, O result,
+		F op, Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{})
+	{
+		if constexpr (detail::Parallelizable<E, I1, S1> &&
+			detail::Parallelizable<E, I2, S2> && RandomAccessIterator<O>)
+		{
+			auto const n1 = static_cast<std::ptrdiff_t>(last1 - first1);
+			auto const n2 = static_cast<std::ptrdiff_t>(last2 - first2);
+			auto const n = n1 < n2 ? n1 : n2;
+			detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+				__stl2::transform(first1 + lo, first1 + hi, first2 + lo, first2 + hi,
+					result + lo, std::ref(op), std::ref(proj1), std::ref(proj2));
+			});
+			return {first1 + n, first2 + n, result + n};
+		} else {
+			return __stl2::transform(std::move(first1), std::move(last1),
+				std::move(first2), std::move(last2), std::move(result),
+				std::ref(op), std::ref(proj1), std::ref(proj2));
+		}
+	}
+
+	template<ext::ExecutionPolicy E, ForwardRange Rng1, ForwardRange Rng2,
+		WeaklyIncrementable O, CopyConstructible F,
+		class Proj1 = identity, class Proj2 = identity>
+	requires
+		Writable<O,
+			indirect_result_t<F&,
+				projected<iterator_t<Rng1>, Proj1>,
+				projected<iterator_t<Rng2>, Proj2>>>
+	tagged_tuple<
+		tag::in1(safe_iterator_t<Rng1>),
+		tag::in2(safe_iterator_t<Rng2>),
+		tag::out(O)>
+	transform(E&& exec, Rng1&& r1, Rng2&& r2, O result, F op,
+		Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{})
+	{
+		return __stl2::transform(std::forward<E>(exec),
+			__stl2::begin(r1), __stl2::end(r1),
+			__stl2::begin(r2), __stl2::end(r2),
+			std::move(result), std::ref(op),
+			std::ref(proj1),
+			std::ref(proj2));
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
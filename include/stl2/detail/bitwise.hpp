@@ -0,0 +1,164 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_BITWISE_HPP
+#define STL2_DETAIL_BITWISE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Bitwise copy and fill kernels [Implementation detail]
+//
+// copy, move, copy_backward, move_backward, fill, fill_n and
+// uninitialized_copy lower to memmove / memset when both sides are
+// contiguous memory of the same trivially copyable type. Contiguous
+// iterators are seen through move_iterator, counted_iterator and
+// reverse_iterator; a copy between two reversed ranges is still a
+// memmove, since element k of each is at the same offset from the
+// lowest address.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail::bitwise {
+		// unwrap<I>::low(i, n) is the lowest address of the n > 0 elements
+		// [i, i + n); reversed is true if i + 1 denotes a lower address
+		// than i.
+		template<class>
+		struct unwrap {};
+
+		template<ContiguousIterator I>
+		struct unwrap<I> {
+			static constexpr bool reversed = false;
+			using element = std::remove_reference_t<iter_reference_t<I>>;
+
+			static element* low(const I& i, iter_difference_t<I>)
+			noexcept(noexcept(ext::to_address(i)))
+			{
+				return ext::to_address(i);
+			}
+		};
+
+		template<class I>
+		concept bool Unwrappable = requires {
+			unwrap<I>::reversed;
+			typename unwrap<I>::element;
+		};
+
+		template<Unwrappable I>
+		struct unwrap<move_iterator<I>> {
+			static constexpr bool reversed = unwrap<I>::reversed;
+			using element = typename unwrap<I>::element;
+
+			static element* low(const move_iterator<I>& i, iter_difference_t<I> n) noexcept {
+				return unwrap<I>::low(i.base(), n);
+			}
+		};
+
+		template<Unwrappable I>
+		struct unwrap<counted_iterator<I>> {
+			static constexpr bool reversed = unwrap<I>::reversed;
+			using element = typename unwrap<I>::element;
+
+			static element* low(const counted_iterator<I>& i, iter_difference_t<I> n) noexcept {
+				return unwrap<I>::low(i.base(), n);
+			}
+		};
+
+		template<Unwrappable I>
+		struct unwrap<reverse_iterator<I>> {
+			static constexpr bool reversed = !unwrap<I>::reversed;
+			using element = typename unwrap<I>::element;
+
+			// [i, i + n) denotes the same elements as [i.base() - n, i.base()).
+			static element* low(const reverse_iterator<I>& i, iter_difference_t<I> n) noexcept {
+				return unwrap<I>::low(i.base() - n, n);
+			}
+		};
+
+		template<class I>
+		using element_t = typename unwrap<I>::element;
+
+		template<class I, class O>
+		concept bool SameLayout =
+			Unwrappable<I> && Unwrappable<O> &&
+			unwrap<I>::reversed == unwrap<O>::reversed &&
+			Same<std::remove_const_t<element_t<I>>, element_t<O>> &&
+			!_Is<element_t<I>, std::is_volatile> &&
+			_Is<element_t<O>, std::is_trivially_copyable>;
+
+		// Assigning R to each element of [o, o + n) from [i, i + n) is a
+		// memmove.
+		template<class I, class O, class R = iter_reference_t<I>>
+		concept bool Assignable =
+			SameLayout<I, O> && std::is_trivially_assignable<element_t<O>&, R>::value;
+
+		// Constructing each element of [o, o + n) from R is a memmove.
+		template<class I, class O, class R = iter_reference_t<I>>
+		concept bool Constructible =
+			SameLayout<I, O> && std::is_trivially_constructible<element_t<O>, R>::value;
+
+		// Assigning const T& to each element of [o, o + n) replicates the
+		// representation of the first.
+		template<class O, class T>
+		concept bool Fillable =
+			Unwrappable<O> &&
+			!_Is<element_t<O>, std::is_volatile> &&
+			_Is<element_t<O>, std::is_trivially_copyable> &&
+			CopyConstructible<element_t<O>> &&
+			std::is_trivially_assignable<element_t<O>&, const T&>::value;
+
+		template<class I, class O>
+		requires SameLayout<I, O>
+		void copy_n(const I& first, iter_difference_t<I> n, const O& result) noexcept {
+			if (n > 0) {
+				std::memmove(unwrap<O>::low(result, n), unwrap<I>::low(first, n),
+					static_cast<std::size_t>(n) * sizeof(element_t<O>));
+			}
+		}
+
+		template<class O, class T>
+		requires Fillable<O, T>
+		void fill_n(const O& first, iter_difference_t<O> n, const T& value) {
+			if (n <= 0) {
+				return;
+			}
+			using E = element_t<O>;
+			E* const p = unwrap<O>::low(first, n);
+			*p = value;
+			if constexpr (sizeof(E) == 1) {
+				unsigned char byte;
+				std::memcpy(&byte, p, 1);
+				std::memset(p + 1, byte, static_cast<std::size_t>(n - 1));
+			} else {
+				unsigned char bytes[sizeof(E)];
+				std::memcpy(bytes, p, sizeof(E));
+				bool zero = true;
+				for (auto b : bytes) {
+					zero = zero && b == 0;
+				}
+				if (zero) {
+					std::memset(p + 1, 0, static_cast<std::size_t>(n - 1) * sizeof(E));
+				} else {
+					// A loop over a pointer vectorizes.
+					E const e = *p;
+					for (E* q = p + 1, *const last = p + n; q != last; ++q) {
+						*q = e;
+					}
+				}
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,153 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_COMMON_TUPLE_HPP
+#define STL2_DETAIL_COMMON_TUPLE_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/object.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// common_tuple [Extension]
+//
+// A std::tuple fit to be the reference type of an iterator whose elements
+// are made up of the elements of other iterators, as zip_view's are. A
+// common_tuple of references is constructible from and assignable from
+// the tuple of values, assigns through its elements even when it is a
+// const prvalue, and has a common_reference with the common_tuples and
+// std::tuples of the same length, so that it is Readable and Writable
+// as the algorithms require of a proxy reference.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class... Ts>
+		class common_tuple : public std::tuple<Ts...> {
+			using base_t = std::tuple<Ts...>;
+
+			template<class T, std::size_t... Is>
+			constexpr common_tuple(T&& that, std::index_sequence<Is...>)
+			: base_t(std::get<Is>(static_cast<T&&>(that))...) {}
+
+			template<class Self, class T, std::size_t... Is>
+			static constexpr void assign(Self& self, T&& that, std::index_sequence<Is...>) {
+				((void)(std::get<Is>(self) = std::get<Is>(static_cast<T&&>(that))), ...);
+			}
+		public:
+			common_tuple() = default;
+
+			constexpr common_tuple(Ts... ts)
+			requires sizeof...(Ts) > 0
+			: base_t(static_cast<Ts&&>(ts)...) {}
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Constructible<Ts, Us&> && ...)
+			constexpr common_tuple(std::tuple<Us...>& that)
+			: common_tuple(that, std::index_sequence_for<Ts...>{}) {}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Constructible<Ts, const Us&> && ...)
+			constexpr common_tuple(const std::tuple<Us...>& that)
+			: common_tuple(that, std::index_sequence_for<Ts...>{}) {}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Constructible<Ts, Us&&> && ...)
+			constexpr common_tuple(std::tuple<Us...>&& that)
+			: common_tuple(std::move(that), std::index_sequence_for<Ts...>{}) {}
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Assignable<Ts&, const Us&> && ...)
+			constexpr common_tuple& operator=(const std::tuple<Us...>& that) {
+				assign(static_cast<base_t&>(*this), that, std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Assignable<Ts&, Us&&> && ...)
+			constexpr common_tuple& operator=(std::tuple<Us...>&& that) {
+				assign(static_cast<base_t&>(*this), std::move(that), std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+
+			// Assignment through a const common_tuple of references, for
+			// the const prvalue that a Writable iterator's operator* may be.
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Assignable<const Ts&, const Us&> && ...)
+			constexpr const common_tuple& operator=(const std::tuple<Us...>& that) const {
+				assign(static_cast<const base_t&>(*this), that, std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) && (Assignable<const Ts&, Us&&> && ...)
+			constexpr const common_tuple& operator=(std::tuple<Us...>&& that) const {
+				assign(static_cast<const base_t&>(*this), std::move(that), std::index_sequence_for<Ts...>{});
+				return *this;
+			}
+		};
+	}
+
+	template<class... Ts, class... Us, template<class> class TQual, template<class> class UQual>
+	requires
+		sizeof...(Ts) == sizeof...(Us) &&
+		(_Valid<common_reference_t, TQual<Ts>, UQual<Us>> && ...)
+	struct basic_common_reference<ext::common_tuple<Ts...>, ext::common_tuple<Us...>, TQual, UQual> {
+		using type = ext::common_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+	};
+	template<class... Ts, class... Us, template<class> class TQual, template<class> class UQual>
+	requires
+		sizeof...(Ts) == sizeof...(Us) &&
+		(_Valid<common_reference_t, TQual<Ts>, UQual<Us>> && ...)
+	struct basic_common_reference<ext::common_tuple<Ts...>, std::tuple<Us...>, TQual, UQual> {
+		using type = ext::common_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+	};
+	template<class... Ts, class... Us, template<class> class TQual, template<class> class UQual>
+	requires
+		sizeof...(Ts) == sizeof...(Us) &&
+		(_Valid<common_reference_t, TQual<Ts>, UQual<Us>> && ...)
+	struct basic_common_reference<std::tuple<Ts...>, ext::common_tuple<Us...>, TQual, UQual> {
+		using type = ext::common_tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+	};
+
+	template<class... Ts, class... Us>
+	requires
+		sizeof...(Ts) == sizeof...(Us) &&
+		(_Valid<common_type_t, Ts, Us> && ...)
+	struct common_type<ext::common_tuple<Ts...>, ext::common_tuple<Us...>> {
+		using type = ext::common_tuple<common_type_t<Ts, Us>...>;
+	};
+	template<class... Ts, class... Us>
+	requires
+		sizeof...(Ts) == sizeof...(Us) &&
+		(_Valid<common_type_t, Ts, Us> && ...)
+	struct common_type<ext::common_tuple<Ts...>, std::tuple<Us...>> {
+		using type = ext::common_tuple<common_type_t<Ts, Us>...>;
+	};
+	template<class... Ts, class... Us>
+	requires
+		sizeof...(Ts) == sizeof...(Us) &&
+		(_Valid<common_type_t, Ts, Us> && ...)
+	struct common_type<std::tuple<Ts...>, ext::common_tuple<Us...>> {
+		using type = ext::common_tuple<common_type_t<Ts, Us>...>;
+	};
+} STL2_CLOSE_NAMESPACE
+
+namespace std {
+	template<class... Ts>
+	struct tuple_size<::__stl2::ext::common_tuple<Ts...>>
+	: tuple_size<tuple<Ts...>> {};
+
+	template<size_t I, class... Ts>
+	struct tuple_element<I, ::__stl2::ext::common_tuple<Ts...>>
+	: tuple_element<I, tuple<Ts...>> {};
+}
+
+#endif
@@ -13,6 +13,8 @@
 #ifndef STL2_DETAIL_CONCEPTS_URNG_HPP
 #define STL2_DETAIL_CONCEPTS_URNG_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/core.hpp>
 #include <stl2/detail/concepts/fundamental.hpp>
@@ -26,6 +28,23 @@ STL2_OPEN_NAMESPACE {
 			{ G::min() } -> Same<decltype(g())>&&;
 			{ G::max() } -> Same<decltype(g())>&&;
 		};
+
+	namespace ext {
+		// [rand.req.seedseq], as far as an engine needs it to seed
+		// itself: q.generate fills a range of 32-bit words, and
+		// q.param(o) writes q.size() words from which an equivalent
+		// sequence can be constructed.
+		template<class Q>
+		concept bool SeedSequence =
+			requires(Q& q, const Q& cq, std::uint32_t* p) {
+				typename Q::result_type;
+				requires UnsignedIntegral<typename Q::result_type>;
+				requires sizeof(typename Q::result_type) >= 4;
+				q.generate(p, p);
+				{ cq.size() } -> std::size_t;
+				cq.param(p);
+			};
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -0,0 +1,128 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_PARALLEL_HPP
+#define STL2_DETAIL_EXECUTION_PARALLEL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/execution/policy.hpp>
+#include <stl2/detail/execution/thread_pool.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Parallel algorithm building blocks [Implementation detail]
+//
+// Each operates on the index range [0, n), which is split into at most
+// a few chunks per pool thread of at least parallel_grain indices each.
+// Chunks are contiguous and handed out in increasing order.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// [first, last) can be split into chunks under policy E.
+		template<class E, class I, class S>
+		concept bool Parallelizable =
+			ext::ParallelPolicy<E> && RandomAccessIterator<I> && SizedSentinel<S, I>;
+
+		// Minimum number of elements per chunk.
+		constexpr std::ptrdiff_t parallel_grain = 1 << 12;
+		// Chunks per pool thread, to balance uneven chunk costs.
+		constexpr std::ptrdiff_t parallel_oversubscription = 4;
+		// Granularity at which searches poll for an earlier result.
+		constexpr std::ptrdiff_t parallel_find_block = 1 << 10;
+
+		inline std::ptrdiff_t parallel_chunks(std::ptrdiff_t n) noexcept {
+			auto const by_grain = (n + parallel_grain - 1) / parallel_grain;
+			auto const by_pool =
+				thread_pool::global().concurrency() * parallel_oversubscription;
+			return by_grain < by_pool ? by_grain : by_pool;
+		}
+
+		inline std::ptrdiff_t chunk_begin(std::ptrdiff_t n, std::ptrdiff_t chunks,
+			std::ptrdiff_t i) noexcept
+		{
+			auto const q = n / chunks, r = n % chunks;
+			return i * q + (i < r ? i : r);
+		}
+
+		// Invokes fn(lo, hi) for each chunk [lo, hi) of [0, n).
+		template<class F>
+		void parallel_for(std::ptrdiff_t n, F&& fn) {
+			auto const chunks = detail::parallel_chunks(n);
+			if (chunks <= 1) {
+				if (n > 0) {
+					fn(std::ptrdiff_t{0}, n);
+				}
+				return;
+			}
+			auto body = [&](std::ptrdiff_t i) {
+				fn(detail::chunk_begin(n, chunks, i), detail::chunk_begin(n, chunks, i + 1));
+			};
+			thread_pool::global().bulk(chunks, body);
+		}
+
+		// Returns fn(c0) op fn(c1) op ... for the chunks c0, c1, ... of
+		// [0, n), which must be non-empty. op need only be associative.
+		template<DefaultConstructible T, class F, class Op>
+		T parallel_reduce(std::ptrdiff_t n, F&& fn, Op&& op) {
+			STL2_EXPECT(n > 0);
+			auto const chunks = detail::parallel_chunks(n);
+			if (chunks <= 1) {
+				return fn(std::ptrdiff_t{0}, n);
+			}
+			std::vector<T> results(chunks);
+			auto body = [&](std::ptrdiff_t i) {
+				results[i] = fn(detail::chunk_begin(n, chunks, i),
+					detail::chunk_begin(n, chunks, i + 1));
+			};
+			thread_pool::global().bulk(chunks, body);
+			T result = std::move(results[0]);
+			for (std::ptrdiff_t i = 1; i < chunks; ++i) {
+				result = op(std::move(result), std::move(results[i]));
+			}
+			return result;
+		}
+
+		// fn(lo, hi) returns the first index in [lo, hi) that satisfies
+		// some predicate, or hi if there is none. Returns the first such
+		// index in [0, n), or n. Chunks that can no longer produce the
+		// answer stop early; if Any, the search stops as soon as any
+		// index is found, and that index is returned.
+		template<bool Any = false, class F>
+		std::ptrdiff_t parallel_find(std::ptrdiff_t n, F&& fn) {
+			std::atomic<std::ptrdiff_t> found{n};
+			detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+				while (lo < hi) {
+					auto const f = found.load(std::memory_order_relaxed);
+					if (Any ? f != n : f < lo) {
+						return;
+					}
+					auto const block_hi = hi - lo > parallel_find_block ?
+						lo + parallel_find_block : hi;
+					auto const pos = fn(lo, block_hi);
+					if (pos != block_hi) {
+						auto prev = found.load(std::memory_order_relaxed);
+						while (pos < prev &&
+							!found.compare_exchange_weak(prev, pos, std::memory_order_relaxed))
+						{}
+						return;
+					}
+					lo = block_hi;
+				}
+			});
+			return found.load(std::memory_order_relaxed);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
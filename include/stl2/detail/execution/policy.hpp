@@ -0,0 +1,64 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_POLICY_HPP
+#define STL2_DETAIL_EXECUTION_POLICY_HPP
+
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Execution policies [Extension]
+//
+// Modeled on [execution.policies] in the Parallelism TS / C++17. The
+// algorithms that accept a policy run in parallel under par and
+// par_unseq when given random-access iterators with sized sentinels, and
+// sequentially otherwise. As in the standard, an element access function
+// that exits via an exception under par or par_unseq calls
+// std::terminate.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext::execution {
+		struct sequenced_policy {};
+		struct parallel_policy {};
+		struct parallel_unsequenced_policy {};
+
+		inline constexpr sequenced_policy seq {};
+		inline constexpr parallel_policy par {};
+		inline constexpr parallel_unsequenced_policy par_unseq {};
+
+		template<class T>
+		constexpr bool is_execution_policy_v = false;
+		template<>
+		constexpr bool is_execution_policy_v<sequenced_policy> = true;
+		template<>
+		constexpr bool is_execution_policy_v<parallel_policy> = true;
+		template<>
+		constexpr bool is_execution_policy_v<parallel_unsequenced_policy> = true;
+
+		template<class T>
+		struct is_execution_policy : meta::bool_<is_execution_policy_v<T>> {};
+	} // namespace ext::execution
+
+	namespace ext {
+		template<class E>
+		concept bool ExecutionPolicy =
+			execution::is_execution_policy_v<__uncvref<E>>;
+
+		template<class E>
+		concept bool ParallelPolicy =
+			ExecutionPolicy<E> && !Same<__uncvref<E>, execution::sequenced_policy>;
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
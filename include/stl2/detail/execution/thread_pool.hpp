@@ -0,0 +1,160 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_EXECUTION_THREAD_POOL_HPP
+#define STL2_DETAIL_EXECUTION_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// thread_pool [Implementation detail]
+//
+// A fixed set of worker threads that cooperatively execute bulk jobs. A
+// bulk job is n invocations f(0), ..., f(n - 1) of a single function
+// object; workers and the submitting thread claim indices in increasing
+// order until none remain. bulk() returns once every invocation has
+// completed.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		class thread_pool {
+			struct job {
+				void (*fn_)(void*, std::ptrdiff_t);
+				void* ctx_;
+				std::ptrdiff_t n_;
+				std::atomic<std::ptrdiff_t> next_{0};
+				int refs_ = 0; // guarded by mtx_
+
+				// Element access functions that throw terminate, as in
+				// [algorithms.parallel.exceptions].
+				void work() noexcept {
+					for (std::ptrdiff_t i; (i = next_.fetch_add(1, std::memory_order_relaxed)) < n_;) {
+						fn_(ctx_, i);
+					}
+				}
+			};
+
+			std::mutex mtx_;
+			std::condition_variable work_cv_;
+			std::condition_variable done_cv_;
+			std::deque<job*> jobs_;
+			std::vector<std::thread> workers_;
+			bool stop_ = false;
+
+			static bool& on_worker() noexcept {
+				static thread_local bool b = false;
+				return b;
+			}
+
+			void worker_loop() {
+				on_worker() = true;
+				std::unique_lock<std::mutex> lock{mtx_};
+				while (true) {
+					work_cv_.wait(lock, [this]{ return stop_ || !jobs_.empty(); });
+					if (stop_) {
+						return;
+					}
+					job* j = jobs_.front();
+					++j->refs_;
+					lock.unlock();
+					j->work();
+					lock.lock();
+					// Every index has been claimed; retire the job.
+					if (!jobs_.empty() && jobs_.front() == j) {
+						jobs_.pop_front();
+					}
+					if (--j->refs_ == 0) {
+						done_cv_.notify_all();
+					}
+				}
+			}
+
+		public:
+			// Creates a pool whose concurrency - counting the thread that
+			// calls bulk() - is n.
+			explicit thread_pool(unsigned n) {
+				n = std::max(n, 1u);
+				workers_.reserve(n - 1);
+				for (unsigned i = 1; i < n; ++i) {
+					workers_.emplace_back([this]{ worker_loop(); });
+				}
+			}
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator=(const thread_pool&) = delete;
+
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> lock{mtx_};
+					stop_ = true;
+				}
+				work_cv_.notify_all();
+				for (auto& t : workers_) {
+					t.join();
+				}
+			}
+
+			std::ptrdiff_t concurrency() const noexcept {
+				return static_cast<std::ptrdiff_t>(workers_.size()) + 1;
+			}
+
+			// Invokes f(i) for each i in [0, n), distributing the
+			// invocations across the pool. Calls from within a job run
+			// inline so that nested parallelism cannot deadlock.
+			template<class F>
+			void bulk(std::ptrdiff_t n, F& f) {
+				if (n <= 0) {
+					return;
+				}
+				if (n == 1 || workers_.empty() || on_worker()) {
+					for (std::ptrdiff_t i = 0; i < n; ++i) {
+						f(i);
+					}
+					return;
+				}
+
+				job j{[](void* ctx, std::ptrdiff_t i) { (*static_cast<F*>(ctx))(i); },
+					std::addressof(f), n};
+				{
+					std::lock_guard<std::mutex> lock{mtx_};
+					jobs_.push_back(&j);
+				}
+				work_cv_.notify_all();
+				j.work();
+
+				std::unique_lock<std::mutex> lock{mtx_};
+				auto pos = std::find(jobs_.begin(), jobs_.end(), &j);
+				if (pos != jobs_.end()) {
+					jobs_.erase(pos);
+				}
+				done_cv_.wait(lock, [&j]{ return j.refs_ == 0; });
+			}
+
+			// The pool shared by the parallel algorithms, sized to the
+			// hardware concurrency.
+			static thread_pool& global() {
+				static thread_pool pool{std::thread::hardware_concurrency()};
+				return pool;
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
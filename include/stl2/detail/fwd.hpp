@@ -27,6 +27,9 @@
   #if __GNUC__ >= 7
    #define STL2_HAS_BUILTIN_addressof 1
   #endif // __GNUC__ >= 7
+  #if __GNUC__ >= 9
+   #define STL2_HAS_BUILTIN_is_constant_evaluated 1
+  #endif // __GNUC__ >= 9
  #endif // __GNUC__
 #endif // __clang__
 
@@ -120,6 +123,14 @@ namespace __stl2 = ::std::experimental::ranges;
  #endif
 #endif
 
+#ifndef STL2_IS_CONSTANT_EVALUATED
+ #if STL2_HAS_BUILTIN(is_constant_evaluated)
+  #define STL2_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+ #endif
+ // Otherwise left undefined: see detail::simd::constant_evaluated for
+ // how the vectorized algorithms tell without it.
+#endif
+
 #ifndef STL2_EXPECT
  #ifdef NDEBUG
   #define STL2_EXPECT(...) STL2_ASSUME(__VA_ARGS__)
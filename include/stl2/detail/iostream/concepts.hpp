@@ -13,7 +13,10 @@
 #define STL2_DETAIL_IOSTREAM_CONCEPTS_HPP
 
 #include <iosfwd>
+#include <type_traits>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
 
 STL2_OPEN_NAMESPACE {
 	///////////////////////////////////////////////////////////////////////////
@@ -35,6 +38,20 @@ STL2_OPEN_NAMESPACE {
 			{ os << t } -> Same<std::basic_ostream<charT, traits>>&;
 			// Axiom: &os == &(os << t)
 		};
+
+	namespace detail {
+		template<class T>
+		constexpr bool is_character =
+			Same<T, char> || Same<T, signed char> || Same<T, unsigned char> ||
+			Same<T, wchar_t> || Same<T, char16_t> || Same<T, char32_t>;
+
+		// The arithmetic types that operator>> and operator<< read and
+		// write as numbers, rather than as characters or as bool.
+		template<class T>
+		concept bool StreamedNumber =
+			(Integral<T> && !Same<T, bool> && !is_character<T>) ||
+			std::is_floating_point<T>::value;
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
@@ -0,0 +1,198 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_IOSTREAM_EXTRACT_HPP
+#define STL2_DETAIL_IOSTREAM_EXTRACT_HPP
+
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <locale>
+#include <string>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+#include <stl2/detail/iostream/concepts.hpp>
+
+#if defined(__GLIBC__)
+ #include <locale.h>
+ #define STL2_EXTRACT_STRTOD_L 1
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+ #include <xlocale.h>
+ #define STL2_EXTRACT_STRTOD_L 1
+#else
+ #define STL2_EXTRACT_STRTOD_L 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Fast extraction of arithmetic values [Extension]
+//
+// istream_view<int>, istream_view<double> and the like parse with
+// extract rather than operator>>. It reads characters straight from the
+// streambuf, and compares them with ASCII digits instead of going through
+// the locale's num_get and ctype facets. It accepts what operator>>
+// accepts in the classic locale with decimal formatting, stores the same
+// value and sets the same state bits. Floating-point text is converted
+// by strtod_l and its siblings in the "C" locale, whatever setlocale has
+// chosen; where those are missing, extract applies only while the global
+// C locale's decimal point is '.', as strtod assumes.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail::extract {
+		// Whether in's formatting lets extract stand in for operator>>.
+		inline bool applies(std::istream& in) {
+			return (in.flags() & std::ios_base::basefield) == std::ios_base::dec &&
+				in.getloc() == std::locale::classic() &&
+				(STL2_EXTRACT_STRTOD_L || std::strcmp(std::localeconv()->decimal_point, ".") == 0);
+		}
+
+		inline bool is_space(int c) noexcept {
+			return c == ' ' || (c >= '\t' && c <= '\r');
+		}
+		inline bool is_digit(int c) noexcept {
+			return c >= '0' && c <= '9';
+		}
+
+#if STL2_EXTRACT_STRTOD_L
+		inline ::locale_t c_locale() {
+			static ::locale_t const loc = ::newlocale(LC_NUMERIC_MASK, "C", ::locale_t{});
+			return loc;
+		}
+
+		inline float strto(const char* s, char** end, float) {
+			return ::strtof_l(s, end, detail::extract::c_locale());
+		}
+		inline double strto(const char* s, char** end, double) {
+			return ::strtod_l(s, end, detail::extract::c_locale());
+		}
+		inline long double strto(const char* s, char** end, long double) {
+			return ::strtold_l(s, end, detail::extract::c_locale());
+		}
+#else
+		inline float strto(const char* s, char** end, float) {
+			return std::strtof(s, end);
+		}
+		inline double strto(const char* s, char** end, double) {
+			return std::strtod(s, end);
+		}
+		inline long double strto(const char* s, char** end, long double) {
+			return std::strtold(s, end);
+		}
+#endif
+
+		template<StreamedNumber T>
+		void extract(std::istream& in, T& t) {
+			using traits = std::char_traits<char>;
+			// Checks the stream and flushes its tie, but leaves whitespace
+			// to be skipped below.
+			const std::istream::sentry ok{in, true};
+			if (!ok) {
+				return;
+			}
+			auto& sb = *in.rdbuf();
+			auto c = sb.sgetc();
+			if (in.flags() & std::ios_base::skipws) {
+				while (is_space(c)) {
+					c = sb.snextc();
+				}
+				if (traits::eq_int_type(c, traits::eof())) {
+					in.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+					return;
+				}
+			}
+			auto state = std::ios_base::goodbit;
+			bool const neg = c == '-';
+			if (neg || c == '+') {
+				c = sb.snextc();
+			}
+
+			if constexpr (Integral<T>) {
+				using U = std::make_unsigned_t<T>;
+				constexpr auto max = static_cast<U>(std::numeric_limits<T>::max());
+				// The magnitude of T's minimum is one more than its maximum.
+				U const limit = SignedIntegral<T> && neg ? max + 1 : max;
+				U v = 0;
+				bool digits = false, overflow = false;
+				for (; is_digit(c); c = sb.snextc()) {
+					digits = true;
+					auto const d = static_cast<U>(c - '0');
+					if (overflow || v > (limit - d) / 10) {
+						overflow = true;
+					} else {
+						v = static_cast<U>(v * 10 + d);
+					}
+				}
+				if (!digits) {
+					t = 0;
+					state |= std::ios_base::failbit;
+				} else if (overflow) {
+					t = SignedIntegral<T> && neg ?
+						std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+					state |= std::ios_base::failbit;
+				} else if constexpr (SignedIntegral<T>) {
+					t = neg && v != 0 ? static_cast<T>(-static_cast<T>(v - 1) - 1) : static_cast<T>(v);
+				} else {
+					t = neg ? static_cast<T>(U{0} - v) : v;
+				}
+			} else {
+				// Gather the longest prefix of
+				// [sign] digits [. digits] [e [sign] digits].
+				std::string text;
+				if (neg) {
+					text += '-';
+				}
+				bool digits = false;
+				auto const gather = [&] {
+					for (; is_digit(c); c = sb.snextc()) {
+						digits = true;
+						text += static_cast<char>(c);
+					}
+				};
+				gather();
+				if (c == '.') {
+					text += '.';
+					c = sb.snextc();
+					gather();
+				}
+				if (digits && (c == 'e' || c == 'E')) {
+					text += 'e';
+					c = sb.snextc();
+					if (c == '-' || c == '+') {
+						text += static_cast<char>(c);
+						c = sb.snextc();
+					}
+					digits = false;
+					gather();
+				}
+				char* end = nullptr;
+				auto const v = digits ? detail::extract::strto(text.c_str(), &end, T{}) : T{};
+				if (!digits || end != text.c_str() + text.size()) {
+					t = 0;
+					state |= std::ios_base::failbit;
+				} else if (std::isinf(v)) {
+					t = v < 0 ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+					state |= std::ios_base::failbit;
+				} else {
+					t = v;
+				}
+			}
+
+			if (traits::eq_int_type(c, traits::eof())) {
+				state |= std::ios_base::eofbit;
+			}
+			in.setstate(state);
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,135 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_IOSTREAM_INSERT_HPP
+#define STL2_DETAIL_IOSTREAM_INSERT_HPP
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <locale>
+#include <ostream>
+#include <streambuf>
+#include <type_traits>
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+#include <stl2/detail/iostream/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Fast insertion of arithmetic values [Extension]
+//
+// The counterpart of extract: insert formats an integral or floating-point
+// value into a buffer on the stack, with plain division for integers and
+// to_chars (or snprintf, where to_chars for floating-point is missing) for
+// the rest, and copies the text straight into the streambuf's put area;
+// the streambuf is called only when the put area is full. It writes what
+// operator<< writes in the classic locale with no flags but dec, no width
+// and a modest precision.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail::insert {
+		// Enough for any integer, or a floating-point value at the
+		// largest precision insert accepts.
+		inline constexpr int buffer_size = 64;
+		inline constexpr std::streamsize max_precision = 40;
+
+		// Whether os's locale lets insert stand in for operator<<.
+		inline bool applies_to_locale(std::ostream& os) {
+			return os.getloc() == std::locale::classic();
+		}
+
+		// Whether os's current formatting does.
+		inline bool applies_to_format(std::ostream& os) noexcept {
+			constexpr auto ignored = std::ios_base::skipws | std::ios_base::boolalpha;
+			return (os.flags() & ~ignored) == std::ios_base::dec && os.width() == 0 &&
+				os.precision() >= 0 && os.precision() <= max_precision;
+		}
+
+		// basic_streambuf keeps its put area protected.
+		struct put_area : std::streambuf {
+			static char *first(std::streambuf& s) {
+				return (s.*&put_area::pptr)();
+			}
+			static char *last(std::streambuf& s) {
+				return (s.*&put_area::epptr)();
+			}
+			static void bump(std::streambuf& s, int n) {
+				(s.*&put_area::pbump)(n);
+			}
+		};
+
+		// Writes [s, s + n) to os's streambuf, setting badbit if it
+		// doesn't take them all.
+		inline void put(std::ostream& os, const char* s, std::streamsize n) {
+			auto& sb = *os.rdbuf();
+			auto const p = put_area::first(sb);
+			if (n <= INT_MAX && put_area::last(sb) - p >= n) {
+				std::memcpy(p, s, static_cast<std::size_t>(n));
+				put_area::bump(sb, static_cast<int>(n));
+			} else if (sb.sputn(s, n) != n) {
+				os.setstate(std::ios_base::badbit);
+			}
+		}
+
+		template<Integral T>
+		char* format(char* last, T const t) noexcept {
+			using U = std::make_unsigned_t<T>;
+			bool const neg = t < 0;
+			U v = neg ? static_cast<U>(U{0} - static_cast<U>(t)) : static_cast<U>(t);
+			do {
+				*--last = static_cast<char>('0' + v % 10);
+				v /= 10;
+			} while (v != 0);
+			if (neg) {
+				*--last = '-';
+			}
+			return last;
+		}
+
+		inline int print(char* s, int n, int precision, double d) noexcept {
+			return std::snprintf(s, static_cast<std::size_t>(n), "%.*g", precision, d);
+		}
+		inline int print(char* s, int n, int precision, long double d) noexcept {
+			return std::snprintf(s, static_cast<std::size_t>(n), "%.*Lg", precision, d);
+		}
+
+		template<StreamedNumber T>
+		void insert(std::ostream& os, T const t) {
+			const std::ostream::sentry ok{os};
+			if (!ok) {
+				return;
+			}
+			char buf[buffer_size];
+			if constexpr (Integral<T>) {
+				auto const first = detail::insert::format(buf + buffer_size, t);
+				detail::insert::put(os, first, buf + buffer_size - first);
+			} else {
+				auto const precision = static_cast<int>(os.precision());
+#if defined(__cpp_lib_to_chars)
+				auto const last = std::to_chars(buf, buf + buffer_size, t,
+					std::chars_format::general, precision).ptr;
+				detail::insert::put(os, buf, last - buf);
+#else
+				// operator<< formats a float as the double it promotes to.
+				using P = std::conditional_t<Same<T, long double>, long double, double>;
+				auto const n = detail::insert::print(buf, buffer_size, precision, P(t));
+				detail::insert::put(os, buf, n);
+#endif
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,60 +13,120 @@
 #define STL2_DETAIL_ITERATOR_ANY_ITERATOR_HPP
 
 #include <atomic>
+#include <cstddef>
 #include <exception>
 #include <new>
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/swap.hpp>
 #include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/iterator/basic_iterator.hpp>
 #include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
 
 STL2_OPEN_NAMESPACE {
 	namespace __any_iterator {
-		enum class op { copy, move, nuke, bump, comp, rval };
-
+		// The count of references to an object stored on the heap. Only
+		// thread-safe erasures pay for an atomic count.
+		template<bool ThreadSafe>
 		struct counted {
-			std::atomic<long> cnt{ 1 };
+			std::conditional_t<ThreadSafe, std::atomic<long>, long> cnt{ 1 };
 		};
-		InputIterator{I} struct shared_iterator : counted {
-			shared_iterator(I i) : it(std::move(i)) {}
-			I it;
+		template<class T, bool ThreadSafe>
+		struct shared : counted<ThreadSafe> {
+			shared(T t) : value(std::move(t)) {}
+			T value;
 		};
 
+		template<std::size_t Size>
 		union blob {
-			counted* big;
-			std::aligned_storage_t<2 * sizeof(void *)> tiny;
+			void *big;
+			std::aligned_storage_t<Size> tiny;
 		};
 
-		template<class It>
-		using is_small =
-			std::integral_constant<bool, (sizeof(It) <= sizeof(blob::tiny))>;
-		using small_tag = std::true_type;
-		using big_tag = std::false_type;
-
-		template<class RValueReference>
-		using iter_move_fn = RValueReference (*)(blob const &);
+		template<class T, std::size_t Size>
+		constexpr bool is_small = sizeof(T) <= Size && alignof(T) <= alignof(blob<Size>);
 
-		template<class RValueReference>
-		inline iter_move_fn<RValueReference> uninit_noop(op, blob *, blob *) {
-			return nullptr;
-		}
+		// Storage of a T in a blob: in place if it fits, otherwise on the
+		// heap, shared by copies. clone copies even a T on the heap.
+		template<class T, std::size_t Size, bool ThreadSafe>
+		struct object {
+			static T &get(blob<Size> &b) noexcept {
+				if constexpr (is_small<T, Size>) {
+					return *static_cast<T *>(static_cast<void *>(&b.tiny));
+				} else {
+					return static_cast<shared<T, ThreadSafe> *>(b.big)->value;
+				}
+			}
+			static T const &get(blob<Size> const &b) noexcept {
+				return object::get(const_cast<blob<Size> &>(b));
+			}
+			static void make(blob<Size> &b, T t) {
+				if constexpr (is_small<T, Size>) {
+					::new (static_cast<void *>(&b.tiny)) T(std::move(t));
+				} else {
+					b.big = new shared<T, ThreadSafe>(std::move(t));
+				}
+			}
+			static void copy(blob<Size> const &src, blob<Size> &dst) {
+				if constexpr (is_small<T, Size>) {
+					::new (static_cast<void *>(&dst.tiny)) T(object::get(src));
+				} else {
+					++static_cast<shared<T, ThreadSafe> *>(dst.big = src.big)->cnt;
+				}
+			}
+			static void clone(blob<Size> const &src, blob<Size> &dst) {
+				object::make(dst, object::get(src));
+			}
+			static void move(blob<Size> &src, blob<Size> &dst) {
+				if constexpr (is_small<T, Size>) {
+					::new (static_cast<void *>(&dst.tiny)) T(std::move(object::get(src)));
+					object::get(src).~T();
+				} else {
+					dst.big = __stl2::exchange(src.big, nullptr);
+				}
+			}
+			static void nuke(blob<Size> &b) noexcept {
+				if constexpr (is_small<T, Size>) {
+					object::get(b).~T();
+				} else {
+					auto p = static_cast<shared<T, ThreadSafe> *>(b.big);
+					if (0 == --p->cnt)
+						delete p;
+				}
+			}
+		};
 
-		template<class Reference>
-		[[noreturn]] inline Reference uninit_deref(blob const &) {
-			std::terminate();
-		}
+		// The operations on an erased iterator, one function each, so that
+		// a caller that knows the erased type can devirtualize any of
+		// them separately.
+		template<class Reference, class RValueReference, std::size_t Size>
+		struct vtable {
+			void (*copy)(blob<Size> const &, blob<Size> &);
+			void (*move)(blob<Size> &, blob<Size> &);
+			void (*nuke)(blob<Size> &) noexcept;
+			void (*bump)(blob<Size> &);
+			bool (*comp)(blob<Size> const &, blob<Size> const &);
+			Reference (*deref)(blob<Size> const &);
+			RValueReference (*rval)(blob<Size> const &);
+		};
 
-		template<class Reference, InputIterator I>
-		Reference deref_small(blob const &src) {
-			return **static_cast<I const *>(static_cast<void const *>(&src.tiny));
-		}
+		// Whether the values of elements whose reference type is
+		// Reference can be assigned to a buffer of ValueType, a chunk at
+		// a time.
+		template<class Reference, class ValueType>
+		concept bool Chunkable =
+			Semiregular<ValueType> && Assignable<ValueType &, Reference>;
 
-		template<class Reference, InputIterator I>
-		Reference deref_big(blob const &src) {
-			return *static_cast<shared_iterator<I> const *>(src.big)->it;
-		}
+		// The operations on an erased iterator that knows its own end:
+		// comparison with default_sentinel, and, when the values are
+		// Chunkable, reading a chunk of them.
+		template<class Reference, class ValueType, class RValueReference, std::size_t Size>
+		struct bounded_vtable : vtable<Reference, RValueReference, Size> {
+			bool (*done)(blob<Size> const &);
+			std::ptrdiff_t (*chunk)(blob<Size> &, ValueType *, std::ptrdiff_t);
+		};
 
 		template<class I, class J>
 		constexpr bool iter_equal(I const &, J const &) {
@@ -78,115 +138,148 @@ STL2_OPEN_NAMESPACE {
 			return i == j;
 		}
 
-		template<class RValueReference, InputIterator I>
-		iter_move_fn<RValueReference> exec_small(op o, blob *src, blob *dst) {
-			switch (o) {
-			case op::copy:
-				::new (static_cast<void *>(&dst->tiny))
-					I(*static_cast<I const *>(static_cast<void *>(&src->tiny)));
-				break;
-			case op::move:
-				::new (static_cast<void *>(&dst->tiny))
-					I(std::move(*static_cast<I *>(static_cast<void *>(&src->tiny))));
-				// fallthrough
-			case op::nuke:
-				static_cast<I *>(static_cast<void *>(&src->tiny))->~I();
-				break;
-			case op::bump:
-				++*static_cast<I *>(static_cast<void *>(&src->tiny));
-				break;
-			case op::comp:
-				if (__any_iterator::iter_equal(
-					*static_cast<I const *>(static_cast<void *>(&src->tiny)),
-					*static_cast<I const *>(static_cast<void *>(&dst->tiny)))) {
-					// fallthrough
-			case op::rval:
-					return +[](blob const &src) -> RValueReference {
-						return __stl2::iter_move(
-							*static_cast<I const *>(static_cast<void const *>(&src.tiny)));
-					};
-				}
+		template<class Reference, class RValueReference, std::size_t Size>
+		struct empty_ops {
+			static void copy(blob<Size> const &, blob<Size> &) {}
+			static void move(blob<Size> &, blob<Size> &) {}
+			static void nuke(blob<Size> &) noexcept {}
+			static void bump(blob<Size> &) {}
+			static bool comp(blob<Size> const &, blob<Size> const &) {
+				return true;
 			}
-			return nullptr;
-		}
+			[[noreturn]] static Reference deref(blob<Size> const &) {
+				std::terminate();
+			}
+			[[noreturn]] static RValueReference rval(blob<Size> const &) {
+				std::terminate();
+			}
+
+			static constexpr vtable<Reference, RValueReference, Size> table = {
+				&copy, &move, &nuke, &bump, &comp, &deref, &rval
+			};
+		};
 
-		template<class RValueReference, InputIterator I>
-		iter_move_fn<RValueReference> exec_big(op o, blob *src, blob *dst) {
-			switch (o) {
-			case op::copy:
-				++(dst->big = src->big)->cnt;
-				break;
-			case op::move:
-				dst->big = __stl2::exchange(src->big, nullptr);
-				break;
-			case op::nuke:
-				if (0 == --src->big->cnt)
-					delete static_cast<shared_iterator<I>*>(src->big);
-				break;
-			case op::bump:
-				++static_cast<shared_iterator<I> *>(src->big)->it;
-				break;
-			case op::comp:
-				if (__any_iterator::iter_equal(
-					static_cast<shared_iterator<I> const *>(src->big)->it,
-					static_cast<shared_iterator<I> const *>(dst->big)->it)) {
-					// fallthrough
-			case op::rval:
-					return +[](blob const &src) -> RValueReference {
-						return __stl2::iter_move(
-							static_cast<shared_iterator<I> const *>(src.big)->it);
-					};
+		// An empty bounded iterator is at its end.
+		template<class Reference, class ValueType, class RValueReference, std::size_t Size>
+		struct bounded_empty_ops : empty_ops<Reference, RValueReference, Size> {
+			static bool done(blob<Size> const &) {
+				return true;
+			}
+			static std::ptrdiff_t chunk(blob<Size> &, ValueType *, std::ptrdiff_t) {
+				return 0;
+			}
+
+			static constexpr bounded_vtable<Reference, ValueType, RValueReference, Size> table = {
+				empty_ops<Reference, RValueReference, Size>::table, &done, &chunk
+			};
+		};
+
+		template<class Reference, class RValueReference,
+			std::size_t Size, bool ThreadSafe, bool Forward, InputIterator I>
+		struct iterator_ops {
+			using obj = object<I, Size, ThreadSafe>;
+
+			static void bump(blob<Size> &b) {
+				++obj::get(b);
+			}
+			static bool comp(blob<Size> const &x, blob<Size> const &y) {
+				return __any_iterator::iter_equal(obj::get(x), obj::get(y));
+			}
+			static Reference deref(blob<Size> const &b) {
+				return *obj::get(b);
+			}
+			static RValueReference rval(blob<Size> const &b) {
+				return __stl2::iter_move(obj::get(b));
+			}
+
+			// Copies of a forward iterator must be independent.
+			static constexpr vtable<Reference, RValueReference, Size> table = {
+				Forward ? &obj::clone : &obj::copy,
+				&obj::move, &obj::nuke, &bump, &comp, &deref, &rval
+			};
+		};
+
+		template<class Reference, class ValueType, class RValueReference,
+			std::size_t Size, bool ThreadSafe, bool Forward, InputIterator I>
+		requires Sentinel<default_sentinel, I>
+		struct bounded_iterator_ops
+		: iterator_ops<Reference, RValueReference, Size, ThreadSafe, Forward, I> {
+			using base_t = iterator_ops<Reference, RValueReference, Size, ThreadSafe, Forward, I>;
+			using obj = typename base_t::obj;
+			using chunk_t = std::ptrdiff_t (*)(blob<Size> &, ValueType *, std::ptrdiff_t);
+
+			static bool done(blob<Size> const &b) {
+				return obj::get(b) == default_sentinel{};
+			}
+			// Assigns the values of up to n elements to buf, stopping at
+			// default_sentinel, and returns how many: the loop over a
+			// chunk runs on the erased type itself.
+			static std::ptrdiff_t chunk(blob<Size> &b, ValueType *buf, std::ptrdiff_t n) {
+				auto &i = obj::get(b);
+				std::ptrdiff_t k = 0;
+				for (; k < n && i != default_sentinel{}; ++i, ++k) {
+					buf[k] = static_cast<Reference>(*i);
 				}
+				return k;
 			}
-			return nullptr;
-		}
 
-		template<class Reference, class ValueType, class RValueReference>
+			// No chunk operation unless the values are Chunkable, since
+			// the cursor never asks for one then.
+			static constexpr bounded_vtable<Reference, ValueType, RValueReference, Size> table = {
+				base_t::table, &done, []() -> chunk_t {
+					if constexpr (Chunkable<Reference, ValueType>) {
+						return &chunk;
+					} else {
+						return nullptr;
+					}
+				}()
+			};
+		};
+
+		// The cursor of an erased iterator. A Bounded one erases only
+		// iterators that know their own end, and compares with
+		// default_sentinel; it is what an erased view's iterators are.
+		template<class Reference, class ValueType, class RValueReference,
+			std::size_t BufferSize, bool ThreadSafe, bool Forward = false,
+			bool Bounded = false>
 		struct cursor {
 		private:
-			blob data_ = { nullptr };
-			Reference (*deref_)(blob const &) =
-				&uninit_deref<Reference>;
-			iter_move_fn<RValueReference> (*exec_)(op, blob *, blob *) =
-				&uninit_noop<RValueReference>;
-
-			InputIterator{I} cursor(I i, small_tag) {
-				::new (static_cast<void *>(&data_.tiny)) I(std::move(i));
-				deref_ = &deref_small<Reference, I>;
-				exec_ = &exec_small<RValueReference, I>;
-			}
-			InputIterator{I} cursor(I i, big_tag) {
-				data_.big = new shared_iterator<I>(std::move(i));
-				deref_ = &deref_big<Reference, I>;
-				exec_ = &exec_big<RValueReference, I>;
-			}
+			using blob_t = blob<BufferSize>;
+			using vtable_t = std::conditional_t<Bounded,
+				bounded_vtable<Reference, ValueType, RValueReference, BufferSize>,
+				vtable<Reference, RValueReference, BufferSize>>;
+			using empty_t = std::conditional_t<Bounded,
+				bounded_empty_ops<Reference, ValueType, RValueReference, BufferSize>,
+				empty_ops<Reference, RValueReference, BufferSize>>;
+
+			blob_t data_ = { nullptr };
+			vtable_t const *vt_ = &empty_t::table;
+
 			void reset() noexcept {
-				exec_(op::nuke, &data_, nullptr);
-				deref_ = &uninit_deref<Reference>;
-				exec_ = &uninit_noop<RValueReference>;
+				__stl2::exchange(vt_, &empty_t::table)->nuke(data_);
 			}
 			void copy_from(cursor const &that) {
 				// Pre: *this is empty
-				that.exec_(op::copy, const_cast<blob *>(&that.data_), &data_);
-				deref_ = that.deref_;
-				exec_ = that.exec_;
+				that.vt_->copy(that.data_, data_);
+				vt_ = that.vt_;
 			}
 			void move_from(cursor &that) {
 				// Pre: *this is empty
-				that.exec_(op::move, &that.data_, &data_);
-				__stl2::swap(deref_, that.deref_);
-				__stl2::swap(exec_, that.exec_);
+				that.vt_->move(that.data_, data_);
+				vt_ = __stl2::exchange(that.vt_, &empty_t::table);
 			}
 		public:
 			using value_type = ValueType;
-			using single_pass = std::true_type;
+			using single_pass = std::integral_constant<bool, !Forward>;
 
 			struct mixin : basic_mixin<cursor> {
 			private:
 				using base_t = basic_mixin<cursor>;
 			public:
 				mixin() = default;
-				InputIterator{I} explicit mixin(I i)
+				template<InputIterator I>
+				requires !Bounded || Sentinel<default_sentinel, I>
+				explicit mixin(I i)
 				: base_t(cursor{std::move(i)})
 				{}
 				using base_t::base_t;
@@ -195,6 +288,20 @@ STL2_OPEN_NAMESPACE {
 				: base_t(std::move(c))
 				{}
 #endif // unknown gcc7 bug
+
+				// Extension: chunked iteration. Assigns the values of the
+				// next elements to a prefix of buf, advances past them, and
+				// returns that prefix, which is empty only at the end.
+				template<class Span>
+				requires
+					Bounded && Chunkable<Reference, ValueType> &&
+					requires(Span &s) {
+						{ s.data() } -> Same<ValueType *>&&;
+						s.first(s.size());
+					}
+				Span next_chunk(Span buf) {
+					return buf.first(base_t::get().chunk(buf.data(), buf.size()));
+				}
 			};
 
 			cursor() = default;
@@ -204,9 +311,19 @@ STL2_OPEN_NAMESPACE {
 			cursor(cursor const &that) {
 				copy_from(that);
 			}
-			InputIterator{I} cursor(I i)
-			: cursor{std::move(i), is_small<I>{}}
-			{}
+			template<InputIterator I>
+			requires !Bounded || Sentinel<default_sentinel, I>
+			cursor(I i)
+			{
+				object<I, BufferSize, ThreadSafe>::make(data_, std::move(i));
+				if constexpr (Bounded) {
+					vt_ = &bounded_iterator_ops<Reference, ValueType, RValueReference,
+						BufferSize, ThreadSafe, Forward, I>::table;
+				} else {
+					vt_ = &iterator_ops<Reference, RValueReference,
+						BufferSize, ThreadSafe, Forward, I>::table;
+				}
+			}
 			cursor &operator=(cursor &&that) {
 				if (&that != this) {
 					reset();
@@ -222,29 +339,96 @@ STL2_OPEN_NAMESPACE {
 				return *this;
 			}
 			~cursor() {
-				exec_(op::nuke, &data_, nullptr);
+				vt_->nuke(data_);
 			}
 			Reference read() const {
-				return deref_(data_);
+				return vt_->deref(data_);
 			}
 			bool equal(cursor const &that) const {
-				return exec_(op::comp, const_cast<blob *>(&data_),
-					const_cast<blob *>(&that.data_)) != nullptr;
+				return vt_->comp(data_, that.data_);
+			}
+			bool equal(default_sentinel) const
+			requires Bounded
+			{
+				return vt_->done(data_);
 			}
 			void next() {
-				exec_(op::bump, &data_, nullptr);
+				vt_->bump(data_);
 			}
 			RValueReference indirect_move() const {
-				return exec_(op::rval, nullptr, nullptr)(data_);
+				return vt_->rval(data_);
+			}
+			std::ptrdiff_t chunk(ValueType *buf, std::ptrdiff_t n)
+			requires Bounded && Chunkable<Reference, ValueType>
+			{
+				return vt_->chunk(data_, buf, n);
 			}
 		};
+
+		// An iterator and its sentinel, as one iterator that knows its own
+		// end: what an erased range erases.
+		template<InputIterator I, Sentinel<I> S>
+		struct bounded_cursor {
+			I first_;
+			S last_;
+
+			using value_type = iter_value_t<I>;
+			using difference_type = iter_difference_t<I>;
+			using single_pass = std::integral_constant<bool, !ForwardIterator<I>>;
+
+			decltype(auto) read() const {
+				return *first_;
+			}
+			void next() {
+				++first_;
+			}
+			bool equal(default_sentinel) const {
+				return first_ == last_;
+			}
+			bool equal(bounded_cursor const &that) const
+			requires ForwardIterator<I>
+			{
+				return first_ == that.first_;
+			}
+			decltype(auto) indirect_move() const {
+				return __stl2::iter_move(first_);
+			}
+		};
+	}
+
+	namespace ext {
+		// any_input_iterator, with BufferSize bytes for iterators stored
+		// in place. Larger iterators are stored on the heap and shared by
+		// copies, with an atomic reference count unless ThreadSafe is
+		// false.
+		template<class Reference,
+			std::size_t BufferSize = 2 * sizeof(void *),
+			bool ThreadSafe = true,
+			class ValueType = __uncvref<Reference>,
+			class RValueReference = __iter_move::rvalue<Reference>>
+		using basic_any_input_iterator =
+			basic_iterator<__any_iterator::cursor<Reference, ValueType,
+				RValueReference, BufferSize, ThreadSafe>>;
+
+		// basic_any_input_iterator of an iterator that knows its own end,
+		// as counted_iterator does, which compares with default_sentinel
+		// as the erased iterator does. Its values are read a chunk at a
+		// time by the algorithms that take chunks.
+		template<class Reference,
+			std::size_t BufferSize = 2 * sizeof(void *),
+			bool ThreadSafe = true,
+			class ValueType = __uncvref<Reference>,
+			class RValueReference = __iter_move::rvalue<Reference>>
+		using basic_any_bounded_input_iterator =
+			basic_iterator<__any_iterator::cursor<Reference, ValueType,
+				RValueReference, BufferSize, ThreadSafe, false, true>>;
 	}
 
 	template<class Reference,
 		class ValueType = __uncvref<Reference>,
 		class RValueReference = __iter_move::rvalue<Reference>>
-	using any_input_iterator =
-		basic_iterator<__any_iterator::cursor<Reference, ValueType, RValueReference>>;
+	using any_input_iterator = ext::basic_any_input_iterator<Reference,
+		2 * sizeof(void *), true, ValueType, RValueReference>;
 
 } STL2_CLOSE_NAMESPACE
 
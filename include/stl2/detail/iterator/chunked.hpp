@@ -0,0 +1,74 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ITERATOR_CHUNKED_HPP
+#define STL2_DETAIL_ITERATOR_CHUNKED_HPP
+
+#include <cstddef>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Chunked iteration [Extension]
+//
+// i.next_chunk(buf) assigns the values of the elements from i on to a
+// prefix of the span buf, advances i past them, and returns that prefix;
+// it returns an empty span only when i has reached default_sentinel. An
+// iterator that pays an indirect call per operation, like the iterators
+// of an erased view, then costs one call per chunk in the algorithms
+// that consume a whole range through it.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I>
+		concept bool ChunkedIterator =
+			InputIterator<I> &&
+			requires(I& i, span<iter_value_t<I>> buf) {
+				{ i.next_chunk(buf) } -> Same<span<iter_value_t<I>>>&&;
+			};
+	}
+
+	namespace detail::chunked {
+		// The bytes of the buffer on the stack that holds a chunk.
+		inline constexpr std::size_t buffer_bytes = 4096;
+
+		// Values too big for a chunk of 16 in the buffer aren't worth
+		// copying through one; the algorithms visit them one at a time.
+		template<class I, class S>
+		concept bool Chunkable =
+			ext::ChunkedIterator<I> && Same<S, default_sentinel> &&
+			Semiregular<iter_value_t<I>> &&
+			sizeof(iter_value_t<I>) <= buffer_bytes / 16;
+
+		// Calls f with successive chunks of the values of
+		// [first, default_sentinel), each held in a buffer of at most
+		// buffer_bytes on the stack.
+		template<class I, class F>
+		requires Chunkable<I, default_sentinel>
+		void for_each(I& first, F f) {
+			using V = iter_value_t<I>;
+			constexpr std::ptrdiff_t n = buffer_bytes / sizeof(V);
+			V buf[n];
+			for (;;) {
+				auto const chunk = first.next_chunk(ext::span<V>{buf, n});
+				if (chunk.empty()) {
+					break;
+				}
+				f(chunk);
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,9 +13,9 @@
 #ifndef STL2_DETAIL_ITERATOR_COMMON_ITERATOR_HPP
 #define STL2_DETAIL_ITERATOR_COMMON_ITERATOR_HPP
 
+#include <new>
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
-#include <stl2/detail/variant.hpp>
 #include <stl2/detail/concepts/compare.hpp>
 #include <stl2/detail/concepts/core.hpp>
 #include <stl2/detail/concepts/object.hpp>
@@ -100,65 +100,200 @@ STL2_OPEN_NAMESPACE {
 			}
 		};
 
-		template<Iterator I, Sentinel<I> S, ConvertibleTo<I> II, ConvertibleTo<S> SS>
-		struct convert_visitor {
-			constexpr auto operator()(const II& i) const
-			STL2_NOEXCEPT_RETURN(
-				std::variant<I, S>{std::in_place_index<0>, i}
-			)
-			constexpr auto operator()(const SS& s) const
-			STL2_NOEXCEPT_RETURN(
-				std::variant<I, S>{std::in_place_index<1>, s}
-			)
-		};
+		// The state of a common_iterator<I, S>: an I, or an S marking the
+		// end. The general case is a union of the two with a flag saying
+		// which is live.
+		template<class I, class S>
+		class storage {
+			union {
+				I iter_;
+				S sent_;
+			};
+			bool is_sentinel_ = false;
 
-		template<Iterator I, Sentinel<I> S, ConvertibleTo<I> II, ConvertibleTo<S> SS>
-		struct assign_visitor {
-			std::variant<I, S> *pv_;
-			void operator()(const II& i) const
-			STL2_NOEXCEPT_RETURN(
-				(void)pv_->template emplace<I>(i)
-			)
-			void operator()(const SS& s) const
-			STL2_NOEXCEPT_RETURN(
-				(void)pv_->template emplace<S>(s)
-			)
-		};
+			void destroy() noexcept {
+				if (is_sentinel_) {
+					sent_.~S();
+				} else {
+					iter_.~I();
+				}
+			}
+		public:
+			storage()
+			noexcept(std::is_nothrow_default_constructible<I>::value)
+			: iter_{} {}
+			storage(I i)
+			noexcept(std::is_nothrow_move_constructible<I>::value)
+			: iter_(std::move(i)) {}
+			storage(S s)
+			noexcept(std::is_nothrow_move_constructible<S>::value)
+			: sent_(std::move(s)), is_sentinel_{true} {}
 
-		template<Iterator I1, Iterator I2, Sentinel<I2> S1, Sentinel<I1> S2>
-		struct equal_visitor {
-			constexpr bool operator()(const I1&, const I2&) const noexcept {
-				return true;
+			storage(const storage& that)
+			noexcept(std::is_nothrow_copy_constructible<I>::value &&
+				std::is_nothrow_copy_constructible<S>::value)
+			: is_sentinel_{that.is_sentinel_} {
+				if (is_sentinel_) {
+					::new (detail::addressof(sent_)) S(that.sent_);
+				} else {
+					::new (detail::addressof(iter_)) I(that.iter_);
+				}
+			}
+			storage(storage&& that)
+			noexcept(std::is_nothrow_move_constructible<I>::value &&
+				std::is_nothrow_move_constructible<S>::value)
+			: is_sentinel_{that.is_sentinel_} {
+				if (is_sentinel_) {
+					::new (detail::addressof(sent_)) S(std::move(that.sent_));
+				} else {
+					::new (detail::addressof(iter_)) I(std::move(that.iter_));
+				}
+			}
+			storage& operator=(const storage& that)
+			noexcept(std::is_nothrow_copy_constructible<I>::value &&
+				std::is_nothrow_copy_constructible<S>::value &&
+				std::is_nothrow_copy_assignable<I>::value &&
+				std::is_nothrow_copy_assignable<S>::value)
+			{
+				if (that.is_sentinel_) {
+					assign_sentinel(that.sent_);
+				} else {
+					assign_iterator(that.iter_);
+				}
+				return *this;
 			}
-			constexpr bool operator()(const I1& i1, const I2& i2) const
-			noexcept(noexcept(bool(i1 == i2)))
-			requires EqualityComparableWith<I1, I2>
+			storage& operator=(storage&& that)
+			noexcept(std::is_nothrow_move_constructible<I>::value &&
+				std::is_nothrow_move_constructible<S>::value &&
+				std::is_nothrow_move_assignable<I>::value &&
+				std::is_nothrow_move_assignable<S>::value)
 			{
-				return i1 == i2;
+				if (that.is_sentinel_) {
+					assign_sentinel(std::move(that.sent_));
+				} else {
+					assign_iterator(std::move(that.iter_));
+				}
+				return *this;
+			}
+			~storage() { destroy(); }
+
+			bool is_sentinel() const noexcept { return is_sentinel_; }
+			I& iterator() noexcept { return iter_; }
+			const I& iterator() const noexcept { return iter_; }
+			const S& sentinel() const noexcept { return sent_; }
+
+			// Switching alternatives makes the new value before destroying
+			// the old one, so that only a move can fail in between.
+			template<class T>
+			void assign_iterator(T&& t) {
+				if (!is_sentinel_) {
+					iter_ = std::forward<T>(t);
+					return;
+				}
+				I tmp(std::forward<T>(t));
+				sent_.~S();
+				::new (detail::addressof(iter_)) I(std::move(tmp));
+				is_sentinel_ = false;
 			}
-			constexpr bool operator()(const auto& lhs, const auto& rhs) const
-			STL2_NOEXCEPT_RETURN(
-				bool(lhs == rhs)
-			)
-			constexpr bool operator()(const S1&, const S2&) const noexcept {
-				return true;
+			template<class T>
+			void assign_sentinel(T&& t) {
+				if (is_sentinel_) {
+					sent_ = std::forward<T>(t);
+					return;
+				}
+				S tmp(std::forward<T>(t));
+				iter_.~I();
+				::new (detail::addressof(sent_)) S(std::move(tmp));
+				is_sentinel_ = true;
 			}
 		};
 
-		template<class I2, SizedSentinel<I2> I1,
-			SizedSentinel<I2> S1, SizedSentinel<I1> S2>
-		struct difference_visitor {
-			constexpr iter_difference_t<I2> operator()(
-				const auto& lhs, const auto& rhs) const
-			STL2_NOEXCEPT_RETURN(
-				static_cast<iter_difference_t<I2>>(lhs - rhs)
-			)
-			constexpr iter_difference_t<I2> operator()(
-				const S1&, const S2&) const noexcept
-			{
-				return 0;
+		// When I and S are trivially copyable, so is the union, and
+		// copying a common_iterator copies bytes.
+		template<class I, class S>
+		requires
+			std::is_trivially_copyable<I>::value &&
+			std::is_trivially_copyable<S>::value &&
+			!std::is_empty<S>::value
+		class storage<I, S> {
+			union {
+				I iter_;
+				S sent_;
+			};
+			bool is_sentinel_ = false;
+		public:
+			constexpr storage()
+			noexcept(std::is_nothrow_default_constructible<I>::value)
+			: iter_{} {}
+			constexpr storage(I i)
+			noexcept(std::is_nothrow_move_constructible<I>::value)
+			: iter_(std::move(i)) {}
+			constexpr storage(S s)
+			noexcept(std::is_nothrow_move_constructible<S>::value)
+			: sent_(std::move(s)), is_sentinel_{true} {}
+
+			constexpr bool is_sentinel() const noexcept { return is_sentinel_; }
+			constexpr I& iterator() noexcept { return iter_; }
+			constexpr const I& iterator() const noexcept { return iter_; }
+			constexpr const S& sentinel() const noexcept { return sent_; }
+
+			template<class T>
+			void assign_iterator(T&& t) {
+				*this = storage{I(std::forward<T>(t))};
+			}
+			template<class T>
+			void assign_sentinel(T&& t) {
+				*this = storage{S(std::forward<T>(t))};
+			}
+		};
+
+		// An empty sentinel - default_sentinel, unreachable - has no value
+		// to keep: the storage is just an I and the flag, and the
+		// sentinel is made afresh when asked for. Comparing with it
+		// then inlines down to a test of the flag and whatever the
+		// sentinel's own comparison does, nothing at all for unreachable.
+		template<class I, class S>
+		requires
+			std::is_empty<S>::value &&
+			std::is_trivially_copyable<S>::value
+		class storage<I, S> {
+			I iter_{};
+			bool is_sentinel_ = false;
+		public:
+			storage() = default;
+			constexpr storage(I i)
+			noexcept(std::is_nothrow_move_constructible<I>::value)
+			: iter_(std::move(i)) {}
+			constexpr storage(S) noexcept(std::is_nothrow_default_constructible<I>::value)
+			: is_sentinel_{true} {}
+
+			constexpr bool is_sentinel() const noexcept { return is_sentinel_; }
+			constexpr I& iterator() noexcept { return iter_; }
+			constexpr const I& iterator() const noexcept { return iter_; }
+			constexpr S sentinel() const noexcept { return S{}; }
+
+			template<class T>
+			constexpr void assign_iterator(T&& t) {
+				iter_ = std::forward<T>(t);
+				is_sentinel_ = false;
+			}
+			template<class T>
+			constexpr void assign_sentinel(T&&) noexcept {
+				is_sentinel_ = true;
 			}
 		};
+
+		template<class I, class S, class II, class SS>
+		constexpr storage<I, S> convert(const storage<II, SS>& that)
+		noexcept(
+			std::is_nothrow_constructible<I, const II&>::value &&
+			std::is_nothrow_constructible<S, const SS&>::value)
+		{
+			if (that.is_sentinel()) {
+				return storage<I, S>{S(that.sentinel())};
+			}
+			return storage<I, S>{I(that.iterator())};
+		}
 	}
 
 	template<Iterator I, Sentinel<I> S>
@@ -168,18 +303,19 @@ STL2_OPEN_NAMESPACE {
 			requires !Same<II, SS>
 		friend class common_iterator;
 		friend __common_iterator::access;
-		std::variant<I, S> v_;
+		__common_iterator::storage<I, S> v_;
 	public:
 		using difference_type = iter_difference_t<I>;
 
 		constexpr common_iterator() = default;
 
 		constexpr common_iterator(I i)
-		noexcept(is_nothrow_constructible<std::variant<I, S>, I>::value)
+		noexcept(std::is_nothrow_move_constructible<I>::value)
 		: v_{std::move(i)} {}
 
 		constexpr common_iterator(S s)
-		noexcept(is_nothrow_constructible<std::variant<I, S>, S>::value)
+		noexcept(std::is_nothrow_move_constructible<S>::value &&
+			std::is_nothrow_default_constructible<I>::value)
 		: v_{std::move(s)} {}
 
 		template<ConvertibleTo<I> II, ConvertibleTo<S> SS>
@@ -187,7 +323,7 @@ STL2_OPEN_NAMESPACE {
 		noexcept(
 			std::is_nothrow_constructible<I, const II&>::value &&
 			std::is_nothrow_constructible<S, const SS&>::value)
-		: v_{std::visit(__common_iterator::convert_visitor<I, S, II, SS>{}, i.v_)}
+		: v_{__common_iterator::convert<I, S>(i.v_)}
 		{}
 
 		template<ConvertibleTo<I> II, ConvertibleTo<S> SS>
@@ -196,46 +332,49 @@ STL2_OPEN_NAMESPACE {
 			std::is_nothrow_assignable<I&, const II&>::value &&
 			std::is_nothrow_assignable<S&, const SS&>::value)
 		{
-			std::visit(
-				__common_iterator::assign_visitor<I, S, II, SS>{&v_}, i.v_);
+			if (i.v_.is_sentinel()) {
+				v_.assign_sentinel(i.v_.sentinel());
+			} else {
+				v_.assign_iterator(i.v_.iterator());
+			}
 			return *this;
 		}
 
 		decltype(auto) operator*()
 		noexcept(noexcept(*std::declval<I&>())) {
-			STL2_EXPECT(std::holds_alternative<I>(v_));
-			return *std::get<I>(v_);
+			STL2_EXPECT(!v_.is_sentinel());
+			return *v_.iterator();
 		}
 		decltype(auto) operator*() const
 		noexcept(noexcept(*std::declval<const I&>()))
 		requires detail::Dereferenceable<const I> {
-			STL2_EXPECT(std::holds_alternative<I>(v_));
-			return *__stl2::__get_unchecked<I>(v_);
+			STL2_EXPECT(!v_.is_sentinel());
+			return *v_.iterator();
 		}
 		decltype(auto) operator->() const
 		noexcept(noexcept(__common_iterator::operator_arrow(std::declval<const I&>())))
 		requires Readable<const I> {
-			STL2_EXPECT(std::holds_alternative<I>(v_));
-			return __common_iterator::operator_arrow(__stl2::__get_unchecked<I>(v_));
+			STL2_EXPECT(!v_.is_sentinel());
+			return __common_iterator::operator_arrow(v_.iterator());
 		}
 
 		common_iterator& operator++()
 		noexcept(noexcept(++declval<I&>()))	{
-			STL2_EXPECT(std::holds_alternative<I>(v_));
-			++__stl2::__get_unchecked<I>(v_);
+			STL2_EXPECT(!v_.is_sentinel());
+			++v_.iterator();
 			return *this;
 		}
 		decltype(auto) operator++(int)
 		noexcept(noexcept((decltype(declval<I&>()++))declval<I&>()++)) {
-			STL2_EXPECT(std::holds_alternative<I>(v_));
-			return __stl2::__get_unchecked<I>(v_)++;
+			STL2_EXPECT(!v_.is_sentinel());
+			return v_.iterator()++;
 		}
 		common_iterator operator++(int)
 		noexcept(noexcept(common_iterator(common_iterator(++declval<common_iterator&>()))))
 		requires ForwardIterator<I> {
-			STL2_EXPECT(std::holds_alternative<I>(v_));
+			STL2_EXPECT(!v_.is_sentinel());
 			auto tmp(*this);
-			++__stl2::__get_unchecked<I>(v_);
+			++v_.iterator();
 			return tmp;
 		}
 
@@ -243,8 +382,8 @@ STL2_OPEN_NAMESPACE {
 			const common_iterator& i)
 			noexcept(noexcept(__stl2::iter_move(std::declval<const I&>())))
 			requires InputIterator<I> {
-			STL2_EXPECT(std::holds_alternative<I>(i.v_));
-			return __stl2::iter_move(__stl2::__get_unchecked<I>(i.v_));
+			STL2_EXPECT(!i.v_.is_sentinel());
+			return __stl2::iter_move(i.v_.iterator());
 		}
 
 		template<IndirectlySwappable<I> I2, class S2>
@@ -252,10 +391,10 @@ STL2_OPEN_NAMESPACE {
 			const common_iterator<I2, S2>& y)
 			noexcept(noexcept(__stl2::iter_swap(std::declval<const I&>(),
 				std::declval<const I2&>()))) {
-			STL2_EXPECT(std::holds_alternative<I>(x.v_));
-			STL2_EXPECT(std::holds_alternative<I2>(__common_iterator::access::v(y)));
-			__stl2::iter_swap(__stl2::__get_unchecked<I>(x.v_),
-				__stl2::__get_unchecked<I2>(__common_iterator::access::v(y)));
+			auto& yv = __common_iterator::access::v(y);
+			STL2_EXPECT(!x.v_.is_sentinel());
+			STL2_EXPECT(!yv.is_sentinel());
+			__stl2::iter_swap(x.v_.iterator(), yv.iterator());
 		}
 	};
 
@@ -275,11 +414,24 @@ STL2_OPEN_NAMESPACE {
 	template<class I1, class I2, Sentinel<I2> S1, Sentinel<I1> S2>
 	bool operator==(
 		const common_iterator<I1, S1>& x, const common_iterator<I2, S2>& y)
-	STL2_NOEXCEPT_RETURN(
-		std::visit(__common_iterator::equal_visitor<I1, I2, S1, S2>{},
-				   __common_iterator::access::v(x),
-				   __common_iterator::access::v(y))
-	)
+	noexcept(
+		noexcept(bool(std::declval<const I1&>() == std::declval<const S2&>())) &&
+		noexcept(bool(std::declval<const I2&>() == std::declval<const S1&>())))
+	{
+		auto& xv = __common_iterator::access::v(x);
+		auto& yv = __common_iterator::access::v(y);
+		if (yv.is_sentinel()) {
+			return xv.is_sentinel() || bool(xv.iterator() == yv.sentinel());
+		}
+		if (xv.is_sentinel()) {
+			return bool(yv.iterator() == xv.sentinel());
+		}
+		if constexpr (EqualityComparableWith<I1, I2>) {
+			return bool(xv.iterator() == yv.iterator());
+		} else {
+			return true;
+		}
+	}
 
 	template<class I1, class I2, Sentinel<I2> S1, Sentinel<I1> S2>
 	bool operator!=(
@@ -292,11 +444,24 @@ STL2_OPEN_NAMESPACE {
 		SizedSentinel<I1> S2>
 	iter_difference_t<I2> operator-(
 		const common_iterator<I1, S1>& x, const common_iterator<I2, S2>& y)
-	STL2_NOEXCEPT_RETURN(
-		std::visit(__common_iterator::difference_visitor<I1, I2, S1, S2>{},
-				   __common_iterator::access::v(x),
-				   __common_iterator::access::v(y))
-	)
+	noexcept(
+		noexcept(std::declval<const I1&>() - std::declval<const I2&>()) &&
+		noexcept(std::declval<const I1&>() - std::declval<const S2&>()) &&
+		noexcept(std::declval<const S1&>() - std::declval<const I2&>()))
+	{
+		auto& xv = __common_iterator::access::v(x);
+		auto& yv = __common_iterator::access::v(y);
+		if (xv.is_sentinel()) {
+			if (yv.is_sentinel()) {
+				return 0;
+			}
+			return static_cast<iter_difference_t<I2>>(xv.sentinel() - yv.iterator());
+		}
+		if (yv.is_sentinel()) {
+			return static_cast<iter_difference_t<I2>>(xv.iterator() - yv.sentinel());
+		}
+		return static_cast<iter_difference_t<I2>>(xv.iterator() - yv.iterator());
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
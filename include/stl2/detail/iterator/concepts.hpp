@@ -24,6 +24,7 @@
 #include <stl2/detail/concepts/core.hpp>
 #include <stl2/detail/concepts/fundamental.hpp>
 #include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/memory/addressof.hpp>
 #include <stl2/detail/iterator/increment.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -383,6 +384,18 @@ STL2_OPEN_NAMESPACE {
 	struct iterator_category<T*>
 	: std::enable_if<std::is_object<T>::value, contiguous_iterator_tag> {};
 
+	// Extension: The standard library's iterators over contiguous storage
+	// (vector, string, ...) are contiguous.
+#if defined(__GLIBCXX__)
+	template<class T, class C>
+	struct iterator_category<::__gnu_cxx::__normal_iterator<T*, C>>
+	: iterator_category<T*> {};
+#elif defined(_LIBCPP_VERSION)
+	template<class T>
+	struct iterator_category<std::__wrap_iter<T*>>
+	: iterator_category<T*> {};
+#endif
+
 	template<class T>
 	struct iterator_category<const T>
 	: iterator_category<T> {};
@@ -547,6 +560,36 @@ STL2_OPEN_NAMESPACE {
 		std::is_lvalue_reference<iter_reference_t<I>>::value &&
 		Same<iter_value_t<I>, __uncvref<iter_reference_t<I>>>;
 
+	///////////////////////////////////////////////////////////////////////////
+	// to_address [Extension]
+	//
+	// The address of the element denoted by a contiguous iterator. Unlike
+	// addressof(*i), it's valid for the end of a range when i has an
+	// operator->.
+	//
+	namespace ext {
+		template<class T>
+		requires _Is<T, std::is_object>
+		constexpr T* to_address(T* p) noexcept {
+			return p;
+		}
+
+		template<ContiguousIterator I>
+		requires
+			requires(const I& i) { i.operator->(); }
+		constexpr auto to_address(const I& i)
+		STL2_NOEXCEPT_RETURN(
+			ext::to_address(i.operator->())
+		)
+
+		// Otherwise, i must be dereferenceable.
+		template<ContiguousIterator I>
+		constexpr auto to_address(const I& i)
+		STL2_NOEXCEPT_RETURN(
+			detail::addressof(*i)
+		)
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	// iterator_traits [iterator.assoc]
 	//
@@ -69,6 +69,11 @@ STL2_OPEN_NAMESPACE {
 		requires detail::Dereferenceable<const I> {
 			return *current();
 		}
+		constexpr auto operator->() const
+		noexcept(noexcept(ext::to_address(std::declval<const I&>())))
+		requires ContiguousIterator<I> {
+			return ext::to_address(current());
+		}
 		constexpr counted_iterator& operator++() {
 			STL2_EXPECT(cnt() > 0);
 			++current();
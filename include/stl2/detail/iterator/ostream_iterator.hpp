@@ -21,6 +21,7 @@
 #include <stl2/detail/concepts/core.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/iostream/concepts.hpp>
+#include <stl2/detail/iostream/insert.hpp>
 #include <stl2/detail/iterator/basic_iterator.hpp>
 #include <stl2/detail/memory/addressof.hpp>
 
@@ -72,6 +73,81 @@ STL2_OPEN_NAMESPACE {
 		const charT* delim_{nullptr};
 	};
 
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////////
+		// buffered_ostream_iterator [Extension]
+		// An ostream_iterator that formats integral and floating-point
+		// values on the stack and copies them, and the delimiter, straight
+		// into the put area of an ostream in the classic locale, as
+		// detail::insert does. The streambuf sees the output a block at a
+		// time, when the put area fills, instead of each value going
+		// through num_put. Other values, and values written while the
+		// stream has flags other than dec set, a nonzero width or a large
+		// precision, go through operator<< as with ostream_iterator.
+		//
+		template<class T = void, class charT = char, class traits = std::char_traits<charT>>
+		requires
+			Same<T, void> ||
+			StreamInsertable<T, charT, traits>
+		class buffered_ostream_iterator {
+		public:
+			using difference_type = ptrdiff_t;
+			using char_type = charT;
+			using traits_type = traits;
+			using ostream_type = std::basic_ostream<charT, traits>;
+
+			constexpr buffered_ostream_iterator() noexcept = default;
+
+			buffered_ostream_iterator(
+				ostream_type& os, const charT* delimiter = nullptr)
+			: out_stream_(detail::addressof(os)), delim_(delimiter)
+			{
+				if constexpr (Same<ostream_type, std::ostream>) {
+					fast_ = detail::insert::applies_to_locale(os);
+					if (delim_) {
+						delim_size_ = static_cast<std::streamsize>(traits::length(delim_));
+					}
+				}
+			}
+
+			template<class U, class V = meta::if_<std::is_void<T>, U, T>>
+			requires
+				ConvertibleTo<U, V const&> &&
+				StreamInsertable<V, charT, traits>
+			buffered_ostream_iterator& operator=(U&& u) {
+				if constexpr (Same<ostream_type, std::ostream> && detail::StreamedNumber<V>) {
+					if (fast_ && detail::insert::applies_to_format(*out_stream_)) {
+						detail::insert::insert(*out_stream_,
+							static_cast<V const &>(std::forward<U>(u)));
+						if (delim_ != nullptr && out_stream_->good()) {
+							detail::insert::put(*out_stream_, delim_, delim_size_);
+						}
+						return *this;
+					}
+				}
+				*out_stream_ << static_cast<V const &>(std::forward<U>(u));
+				if (delim_ != nullptr) {
+					*out_stream_ << delim_;
+				}
+				return *this;
+			}
+
+			buffered_ostream_iterator& operator*() noexcept {
+				return *this;
+			}
+			buffered_ostream_iterator& operator++() noexcept {
+				return *this;
+			}
+			buffered_ostream_iterator& operator++(int) noexcept {
+				return *this;
+			}
+		private:
+			detail::raw_ptr<basic_ostream<charT, traits>> out_stream_{nullptr};
+			const charT* delim_{nullptr};
+			std::streamsize delim_size_{0};
+			bool fast_{false};
+		};
+	}
 } STL2_CLOSE_NAMESPACE
 
 #endif
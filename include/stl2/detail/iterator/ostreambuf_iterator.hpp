@@ -25,6 +25,7 @@
 STL2_OPEN_NAMESPACE {
 	// Not to spec:
 	// * Extension: satisfies EqualityComparable and Sentinel<default_sentinel>
+	// * Extension: write(s, n) stores n characters with a single sputn
 	template<class charT, class traits = std::char_traits<charT>>
 	class ostreambuf_iterator {
 	public:
@@ -50,6 +51,14 @@ STL2_OPEN_NAMESPACE {
 			}
 			return *this;
 		}
+		ostreambuf_iterator& write(const charT* s, std::streamsize n) {
+			if (sbuf_) {
+				if (sbuf_->sputn(s, n) != n) {
+					sbuf_ = nullptr;
+				}
+			}
+			return *this;
+		}
 		ostreambuf_iterator& operator*() noexcept {
 			return *this;
 		}
@@ -60,7 +69,7 @@ STL2_OPEN_NAMESPACE {
 			return *this;
 		}
 		bool failed() const noexcept {
-			return sbuf_ != nullptr;
+			return sbuf_ == nullptr;
 		}
 		friend bool operator==(ostreambuf_iterator a, ostreambuf_iterator b) noexcept {
 			return a.sbuf_ == b.sbuf_;
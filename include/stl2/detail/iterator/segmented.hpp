@@ -0,0 +1,190 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ITERATOR_SEGMENTED_HPP
+#define STL2_DETAIL_ITERATOR_SEGMENTED_HPP
+
+#include <utility>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/range/access.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Segmented iteration [Extension]
+//
+// i.segment() is a span of the elements from i on that lie contiguously
+// in memory, empty only when i has reached default_sentinel, and
+// i.consume(n) advances i past the first n of them. An algorithm that
+// consumes a whole range through such an iterator runs its loop over
+// plain pointers, one segment at a time.
+//
+// On the output side, o.write(p, n) stores the n elements at p through
+// o as n assignments *o++ = p[i] would, but with a single call, so that
+// copying a contiguous range to o writes it in one piece.
+//
+// Hierarchical iteration: an iterator over a range of ranges, like
+// join_view's, is also a segment iterator to one of the inner ranges
+// and a local iterator into it. segmented_iterator_traits<I> exposes
+// that structure, so that an algorithm can run its plain loop over each
+// inner range in turn, and cross the boundaries between them once per
+// inner range rather than test for them at every element. An iterator
+// opts in with the members outer(), inner(), outer_end() - the end of
+// the segments - and compose(s, l), the iterator at l in *s; a sentinel
+// opts in with outer(), which is outer_end() of the iterators it ends.
+// Other iterators, such as those of a container of blocks, can
+// specialize segmented_iterator_traits instead.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I>
+		concept bool SegmentedIterator =
+			InputIterator<I> &&
+			requires(I& i, const I& ci, iter_difference_t<I> n) {
+				{ ci.segment() } -> Same<span<const iter_value_t<I>>>&&;
+				i.consume(n);
+			};
+
+		template<class O, class T>
+		concept bool SegmentedOutputIterator =
+			OutputIterator<O, const T&> &&
+			requires(O& o, const T* p, iter_difference_t<O> n) {
+				o.write(p, n);
+			};
+	}
+
+	namespace detail::segmented {
+		template<class I, class S>
+		concept bool Segmentable =
+			ext::SegmentedIterator<I> && Same<S, default_sentinel>;
+
+		template<class I, class S, class O>
+		concept bool Writable =
+			ContiguousIterator<I> && SizedSentinel<S, I> &&
+			ext::SegmentedOutputIterator<O, iter_value_t<I>>;
+	}
+
+	namespace ext {
+		template<class I>
+		struct segmented_iterator_traits {};
+
+		template<class I>
+		requires
+			requires(const I& i) {
+				i.outer();
+				i.inner();
+				i.outer_end();
+				{ i.compose(i.outer(), i.inner()) } -> Same<I>&&;
+			}
+		struct segmented_iterator_traits<I> {
+			using segment_iterator = decltype(std::declval<const I&>().outer());
+			using local_iterator = decltype(std::declval<const I&>().inner());
+
+			static constexpr segment_iterator segment(const I& i) {
+				return i.outer();
+			}
+			template<class S>
+			requires requires(const S& s) { s.outer(); }
+			static constexpr auto segment(const S& s) {
+				return s.outer();
+			}
+			static constexpr local_iterator local(const I& i) {
+				return i.inner();
+			}
+			static constexpr auto segment_end(const I& i) {
+				return i.outer_end();
+			}
+			static constexpr local_iterator begin(const segment_iterator& s) {
+				return __stl2::begin(*s);
+			}
+			static constexpr auto end(const segment_iterator& s) {
+				return __stl2::end(*s);
+			}
+			static constexpr I compose(const I& i, segment_iterator s, local_iterator l) {
+				return i.compose(std::move(s), std::move(l));
+			}
+		};
+
+		template<class I>
+		concept bool HierarchicalIterator =
+			Iterator<I> &&
+			requires { typename segmented_iterator_traits<I>::segment_iterator; };
+	}
+
+	namespace detail::segmented {
+		template<class I, class S>
+		concept bool Hierarchical =
+			ext::HierarchicalIterator<I> &&
+			requires(const S& s) {
+				ext::segmented_iterator_traits<I>::segment(s);
+			};
+
+		// Calls f(lfirst, llast) with each of the local ranges that make
+		// up [first, last) in turn, and returns the end of [first, last).
+		template<class I, class S, class F>
+		requires Hierarchical<I, S>
+		constexpr I for_each_local(const I& first, const S& last, F f) {
+			using T = ext::segmented_iterator_traits<I>;
+			auto seg = T::segment(first);
+			auto const send = T::segment_end(first);
+			auto const slast = T::segment(last);
+			auto lfirst = T::local(first);
+			while (seg != slast) {
+				f(std::move(lfirst), T::end(seg));
+				if (++seg == send) {
+					return T::compose(first, std::move(seg), {});
+				}
+				lfirst = T::begin(seg);
+			}
+			if constexpr (Same<I, S>) {
+				if (seg != send) {
+					f(std::move(lfirst), T::local(last));
+					return last;
+				}
+			}
+			return T::compose(first, std::move(seg), {});
+		}
+
+		// As for_each_local, but f returns the position in its local range
+		// at which it stopped; find_local stops too, at the first that is
+		// short of llast, and returns the iterator there.
+		template<class I, class S, class F>
+		requires Hierarchical<I, S>
+		constexpr I find_local(const I& first, const S& last, F f) {
+			using T = ext::segmented_iterator_traits<I>;
+			auto seg = T::segment(first);
+			auto const send = T::segment_end(first);
+			auto const slast = T::segment(last);
+			auto lfirst = T::local(first);
+			while (seg != slast) {
+				auto const lend = T::end(seg);
+				auto p = f(std::move(lfirst), lend);
+				if (p != lend) {
+					return T::compose(first, std::move(seg), std::move(p));
+				}
+				if (++seg == send) {
+					return T::compose(first, std::move(seg), {});
+				}
+				lfirst = T::begin(seg);
+			}
+			if constexpr (Same<I, S>) {
+				if (seg != send) {
+					return T::compose(first, std::move(seg),
+						f(std::move(lfirst), T::local(last)));
+				}
+			}
+			return T::compose(first, std::move(seg), {});
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,6 +13,7 @@
 #ifndef STL2_DETAIL_MEMORY_UNINITIALIZED_COPY_HPP
 #define STL2_DETAIL_MEMORY_UNINITIALIZED_COPY_HPP
 
+#include <stl2/detail/bitwise.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/algorithm/tagspec.hpp>
 #include <stl2/detail/memory/concepts.hpp>
@@ -31,6 +32,11 @@ STL2_OPEN_NAMESPACE {
 	requires
 		Constructible<iter_value_t<O>, iter_reference_t<I>>
 	{
+		if constexpr (SizedSentinel<S, I> && detail::bitwise::Constructible<I, O>) {
+			auto const n = iter_difference_t<I>(last - first);
+			detail::bitwise::copy_n(first, n, result);
+			return {first + n, result + n};
+		}
 		auto guard = detail::destroy_guard<O>{result};
 		for (; first != last; ++result, (void)++first) {
 			__stl2::__construct_at(*result, *first);
@@ -61,6 +67,15 @@ STL2_OPEN_NAMESPACE {
 	tagged_pair<tag::in(I), tag::out(O)>
 	uninitialized_copy(I ifirst, S1 ilast, O ofirst, S2 olast)
 	{
+		if constexpr (SizedSentinel<S1, I> && SizedSentinel<S2, O> &&
+			detail::bitwise::Constructible<I, O>)
+		{
+			auto const n1 = iter_difference_t<I>(ilast - ifirst);
+			auto const n2 = iter_difference_t<I>(olast - ofirst);
+			auto const n = n1 < n2 ? n1 : n2;
+			detail::bitwise::copy_n(ifirst, n, ofirst);
+			return {ifirst + n, ofirst + n};
+		}
 		auto guard = detail::destroy_guard<O>{ofirst};
 		for (; ifirst != ilast && ofirst != olast; ++ofirst, (void)++ifirst) {
 			__stl2::__construct_at(*ofirst, *ifirst);
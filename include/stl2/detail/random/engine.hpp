@@ -0,0 +1,268 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_RANDOM_ENGINE_HPP
+#define STL2_DETAIL_RANDOM_ENGINE_HPP
+
+#include <array>
+#include <cstdint>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/urng.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Small-state random number engines [Extension]
+//
+// splitmix64, xoshiro256** and pcg64 are 64-bit engines with 8 to 32
+// bytes of state, far cheaper to construct and seed than mt19937_64. Each
+// can be seeded from a single integer or from an ext::SeedSequence.
+// splitmix64 and pcg64 discard in constant and logarithmic time
+// respectively; xoshiro256** instead has jump(). pcg64 needs a 128-bit
+// integer type, and exists only where the compiler has one.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail::random {
+#ifdef __SIZEOF_INT128__
+		__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+		constexpr std::uint64_t rotl(std::uint64_t x, int k) noexcept {
+			return (x << k) | (x >> ((64 - k) & 63));
+		}
+		constexpr std::uint64_t rotr(std::uint64_t x, unsigned k) noexcept {
+			return (x >> k) | (x << ((64 - k) & 63));
+		}
+
+		// N 64-bit words from 2N 32-bit words of q.
+		template<std::size_t N, ext::SeedSequence Q>
+		std::array<std::uint64_t, N> seed_words(Q& q) {
+			std::array<std::uint32_t, 2 * N> w;
+			q.generate(w.begin(), w.end());
+			std::array<std::uint64_t, N> result;
+			for (std::size_t i = 0; i < N; ++i) {
+				result[i] = std::uint64_t{w[2 * i]} << 32 | w[2 * i + 1];
+			}
+			return result;
+		}
+	}
+
+	namespace ext {
+		// Steele, Lea and Flood's SplitMix64: a Weyl sequence through a
+		// 64-bit finalizer. Mostly useful to expand one seed into the
+		// state of another engine.
+		class splitmix64 {
+			std::uint64_t state_;
+			static constexpr std::uint64_t gamma = 0x9e3779b97f4a7c15;
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0;
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			constexpr splitmix64() noexcept : splitmix64(default_seed) {}
+			constexpr explicit splitmix64(result_type s) noexcept : state_(s) {}
+			template<SeedSequence Q>
+			requires !Same<Q, splitmix64>
+			explicit splitmix64(Q& q) { seed(q); }
+
+			constexpr void seed(result_type s = default_seed) noexcept { state_ = s; }
+			template<SeedSequence Q>
+			void seed(Q& q) { state_ = detail::random::seed_words<1>(q)[0]; }
+
+			constexpr result_type operator()() noexcept {
+				auto z = (state_ += gamma);
+				z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+				z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+				return z ^ (z >> 31);
+			}
+
+			constexpr void discard(unsigned long long n) noexcept {
+				state_ += gamma * n;
+			}
+
+			friend constexpr bool operator==(const splitmix64& x, const splitmix64& y) noexcept {
+				return x.state_ == y.state_;
+			}
+			friend constexpr bool operator!=(const splitmix64& x, const splitmix64& y) noexcept {
+				return !(x == y);
+			}
+		};
+
+		// Blackman and Vigna's xoshiro256**: 256 bits of state, period
+		// 2^256 - 1. jump() advances by 2^128 steps, to split one seed
+		// into non-overlapping streams.
+		class xoshiro256starstar {
+			std::array<std::uint64_t, 4> s_;
+
+			constexpr void fix_zero() noexcept {
+				if ((s_[0] | s_[1] | s_[2] | s_[3]) == 0) {
+					s_[0] = 0x9e3779b97f4a7c15; // The all-zero state is a fixed point.
+				}
+			}
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0;
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			constexpr xoshiro256starstar() noexcept : xoshiro256starstar(default_seed) {}
+			constexpr explicit xoshiro256starstar(result_type s) noexcept : s_{} { seed(s); }
+			template<SeedSequence Q>
+			requires !Same<Q, xoshiro256starstar>
+			explicit xoshiro256starstar(Q& q) : s_{} { seed(q); }
+			// The raw state; all zero is replaced by a fixed nonzero state.
+			constexpr explicit xoshiro256starstar(const std::array<std::uint64_t, 4>& s) noexcept
+			: s_(s) { fix_zero(); }
+
+			// The state is s expanded by splitmix64, as its authors suggest.
+			constexpr void seed(result_type s = default_seed) noexcept {
+				splitmix64 sm{s};
+				for (auto& w : s_) {
+					w = sm();
+				}
+			}
+			template<SeedSequence Q>
+			void seed(Q& q) {
+				s_ = detail::random::seed_words<4>(q);
+				fix_zero();
+			}
+
+			constexpr result_type operator()() noexcept {
+				auto const result = detail::random::rotl(s_[1] * 5, 7) * 9;
+				auto const t = s_[1] << 17;
+				s_[2] ^= s_[0];
+				s_[3] ^= s_[1];
+				s_[1] ^= s_[2];
+				s_[0] ^= s_[3];
+				s_[2] ^= t;
+				s_[3] = detail::random::rotl(s_[3], 45);
+				return result;
+			}
+
+			constexpr void discard(unsigned long long n) noexcept {
+				for (; n != 0; --n) {
+					(*this)();
+				}
+			}
+
+			constexpr void jump() noexcept {
+				constexpr std::uint64_t poly[] = {
+					0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+					0xa9582618e03fc9aa, 0x39abdc4529b1661c
+				};
+				std::array<std::uint64_t, 4> t{};
+				for (auto p : poly) {
+					for (int b = 0; b < 64; ++b) {
+						if (p & (std::uint64_t{1} << b)) {
+							for (int i = 0; i < 4; ++i) {
+								t[i] ^= s_[i];
+							}
+						}
+						(*this)();
+					}
+				}
+				s_ = t;
+			}
+
+			friend constexpr bool operator==(const xoshiro256starstar& x,
+				const xoshiro256starstar& y) noexcept
+			{
+				return x.s_[0] == y.s_[0] && x.s_[1] == y.s_[1] &&
+					x.s_[2] == y.s_[2] && x.s_[3] == y.s_[3];
+			}
+			friend constexpr bool operator!=(const xoshiro256starstar& x,
+				const xoshiro256starstar& y) noexcept
+			{
+				return !(x == y);
+			}
+		};
+
+#ifdef __SIZEOF_INT128__
+		// O'Neill's PCG64 (XSL RR 128/64): a 128-bit LCG whose high and
+		// low halves are xor-folded and randomly rotated. The increment
+		// selects one of 2^127 streams.
+		class pcg64 {
+			using uint128_t = detail::random::uint128_t;
+
+			static constexpr uint128_t multiplier =
+				uint128_t{0x2360ed051fc65da4} << 64 | 0x4385df649fccf645;
+			uint128_t state_ = 0;
+			uint128_t inc_ = 1;
+
+			constexpr void step() noexcept {
+				state_ = state_ * multiplier + inc_;
+			}
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0xcafef00dd15ea5e5;
+			static constexpr result_type default_stream = 0xa02bdbf7bb3c0a7;
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			constexpr pcg64() noexcept { seed(); }
+			constexpr explicit pcg64(uint128_t s, uint128_t stream = default_stream) noexcept {
+				seed(s, stream);
+			}
+			template<SeedSequence Q>
+			requires !Same<Q, pcg64>
+			explicit pcg64(Q& q) { seed(q); }
+
+			// As pcg_setseq_128_srandom_r.
+			constexpr void seed(uint128_t s = default_seed, uint128_t stream = default_stream) noexcept {
+				state_ = 0;
+				inc_ = stream << 1 | 1;
+				step();
+				state_ += s;
+				step();
+			}
+			template<SeedSequence Q>
+			void seed(Q& q) {
+				auto const w = detail::random::seed_words<4>(q);
+				seed(uint128_t{w[0]} << 64 | w[1], uint128_t{w[2]} << 64 | w[3]);
+			}
+
+			constexpr result_type operator()() noexcept {
+				step();
+				return detail::random::rotr(
+					static_cast<std::uint64_t>(state_ >> 64) ^ static_cast<std::uint64_t>(state_),
+					static_cast<unsigned>(state_ >> 122));
+			}
+
+			// Brown's algorithm for jumping an LCG ahead by n steps.
+			constexpr void discard(unsigned long long n) noexcept {
+				uint128_t acc_mult = 1, acc_plus = 0;
+				uint128_t cur_mult = multiplier, cur_plus = inc_;
+				for (; n != 0; n >>= 1) {
+					if (n & 1) {
+						acc_mult *= cur_mult;
+						acc_plus = acc_plus * cur_mult + cur_plus;
+					}
+					cur_plus = (cur_mult + 1) * cur_plus;
+					cur_mult *= cur_mult;
+				}
+				state_ = acc_mult * state_ + acc_plus;
+			}
+
+			friend constexpr bool operator==(const pcg64& x, const pcg64& y) noexcept {
+				return x.state_ == y.state_ && x.inc_ == y.inc_;
+			}
+			friend constexpr bool operator!=(const pcg64& x, const pcg64& y) noexcept {
+				return !(x == y);
+			}
+		};
+#endif
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,158 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_RANDOM_RESERVOIR_HPP
+#define STL2_DETAIL_RANDOM_RESERVOIR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/concepts/urng.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// weighted_reservoir [Extension]
+//
+// A weighted sample without replacement of at most k items from a stream
+// of unknown length, by Efraimidis and Spirakis' A-ExpJ. Each item gets
+// the key u^(1 / weight) for u uniform in (0, 1), and the reservoir keeps
+// the k largest keys. Keys are independent, so the reservoirs of disjoint
+// shards of a stream merge into exactly the reservoir of the whole:
+// sample each shard on its own thread, then merge. With all weights
+// equal, the sample is uniform.
+//
+// Rather than draw a key for every item, the reservoir draws once how
+// much weight will pass before some item beats its smallest key, so a
+// stream of n items costs O(k log(n / k)) random numbers.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<Movable T>
+		class weighted_reservoir {
+			struct entry {
+				double key; // log of u^(1 / weight), to keep precision
+				T value;
+			};
+			static bool key_greater(const entry& x, const entry& y) noexcept {
+				return x.key > y.key;
+			}
+
+			std::vector<entry> heap_; // the entry with the least key first
+			std::size_t capacity_;
+			double skip_ = -1.0;      // weight left to pass over; < 0 if undrawn
+
+			void push_entry(double key, T&& value) {
+				heap_.push_back(entry{key, std::move(value)});
+				std::push_heap(heap_.begin(), heap_.end(), key_greater);
+			}
+		public:
+			explicit weighted_reservoir(std::ptrdiff_t k)
+			: capacity_(static_cast<std::size_t>(k))
+			{
+				STL2_EXPECT(k >= 0);
+				heap_.reserve(capacity_);
+			}
+
+			std::ptrdiff_t capacity() const noexcept {
+				return static_cast<std::ptrdiff_t>(capacity_);
+			}
+			std::ptrdiff_t size() const noexcept {
+				return static_cast<std::ptrdiff_t>(heap_.size());
+			}
+			bool empty() const noexcept {
+				return heap_.empty();
+			}
+
+			// Offers value with the given weight. Returns true if value is
+			// now in the sample. Items of weight zero are never sampled.
+			template<UniformRandomNumberGenerator G>
+			bool push(T value, double weight, G& g) {
+				STL2_EXPECT(weight >= 0.0);
+				if (weight <= 0.0 || capacity_ == 0) {
+					return false;
+				}
+				if (heap_.size() < capacity_) {
+					push_entry(std::log(detail::random::unit_open(g)) / weight, std::move(value));
+					return true;
+				}
+				auto const t = heap_.front().key;
+				if (skip_ < 0.0) {
+					// The weight to pass before a key beats exp(t) is
+					// exponential with rate -t.
+					skip_ = std::log(detail::random::unit_open(g)) / t;
+				}
+				skip_ -= weight;
+				if (skip_ > 0.0) {
+					return false;
+				}
+				// This item's key is conditioned to beat exp(t): u is
+				// uniform in (exp(t * weight), 1).
+				auto const tw = std::exp(t * weight);
+				auto const u = tw + (1.0 - tw) * detail::random::unit_open(g);
+				std::pop_heap(heap_.begin(), heap_.end(), key_greater);
+				heap_.pop_back();
+				push_entry(std::log(u) / weight, std::move(value));
+				skip_ = -1.0;
+				return true;
+			}
+
+			template<UniformRandomNumberGenerator G>
+			bool push(T value, G& g) {
+				return push(std::move(value), 1.0, g);
+			}
+
+			// Makes this the reservoir of the union of both streams.
+			void merge(weighted_reservoir&& that) {
+				for (auto& e : that.heap_) {
+					heap_.push_back(std::move(e));
+				}
+				that.heap_.clear();
+				if (heap_.size() > capacity_) {
+					std::nth_element(heap_.begin(), heap_.begin() + capacity_,
+						heap_.end(), key_greater);
+					heap_.erase(heap_.begin() + capacity_, heap_.end());
+				}
+				std::make_heap(heap_.begin(), heap_.end(), key_greater);
+				skip_ = -1.0;
+			}
+
+			void merge(const weighted_reservoir& that) {
+				weighted_reservoir copy = that;
+				merge(std::move(copy));
+			}
+
+			// The sampled items, in no particular order.
+			std::vector<T> items() const& {
+				std::vector<T> result;
+				result.reserve(heap_.size());
+				for (auto& e : heap_) {
+					result.push_back(e.value);
+				}
+				return result;
+			}
+			std::vector<T> items() && {
+				std::vector<T> result;
+				result.reserve(heap_.size());
+				for (auto& e : heap_) {
+					result.push_back(std::move(e.value));
+				}
+				heap_.clear();
+				return result;
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
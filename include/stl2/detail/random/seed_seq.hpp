@@ -0,0 +1,118 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_RANDOM_SEED_SEQ_HPP
+#define STL2_DETAIL_RANDOM_SEED_SEQ_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// seed_seq_fe [Extension]
+//
+// A fixed-entropy SeedSequence, after O'Neill's randutils: it keeps N
+// 32-bit words of entropy in place rather than in a heap-allocated vector
+// as std::seed_seq does, and spreads every word into every generated
+// word. Input beyond N words is folded into the N kept words, so param()
+// reproduces the sequence though not necessarily its original input.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<std::size_t N = 8>
+		requires N > 0
+		class seed_seq_fe {
+			std::array<std::uint32_t, N> words_{};
+
+			static constexpr std::uint64_t mix(std::uint64_t z) noexcept {
+				z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+				z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+				return z ^ (z >> 31);
+			}
+
+			template<InputIterator I, Sentinel<I> S>
+			constexpr void assign(I first, S last) {
+				for (std::size_t i = 0; first != last; ++first, ++i) {
+					auto const v = static_cast<std::uint32_t>(*first);
+					auto& w = words_[i % N];
+					w = i < N ? v : static_cast<std::uint32_t>(
+						mix(std::uint64_t{w} << 32 | v) >> 32);
+				}
+			}
+		public:
+			using result_type = std::uint32_t;
+
+			constexpr seed_seq_fe() noexcept = default;
+			template<Integral T>
+			constexpr seed_seq_fe(std::initializer_list<T> il) {
+				assign(il.begin(), il.end());
+			}
+			template<InputIterator I, Sentinel<I> S>
+			requires Integral<iter_value_t<I>>
+			constexpr seed_seq_fe(I first, S last) {
+				assign(std::move(first), std::move(last));
+			}
+
+			seed_seq_fe(const seed_seq_fe&) = delete;
+			seed_seq_fe& operator=(const seed_seq_fe&) = delete;
+
+			// Word k of the output is a hash of k and every kept word.
+			template<RandomAccessIterator I, Sentinel<I> S>
+			requires Writable<I, std::uint32_t>
+			constexpr void generate(I first, S last) const {
+				for (std::uint64_t k = 1; first != last; ++first, ++k) {
+					auto h = k * 0x9e3779b97f4a7c15 ^ N;
+					for (auto w : words_) {
+						h = mix(h ^ w);
+					}
+					*first = static_cast<std::uint32_t>(h >> 32);
+				}
+			}
+
+			static constexpr std::size_t size() noexcept { return N; }
+
+			template<OutputIterator<const std::uint32_t&> O>
+			constexpr void param(O out) const {
+				for (auto w : words_) {
+					*out = w;
+					++out;
+				}
+			}
+		};
+	}
+
+	namespace detail::random {
+		// Fresh entropy for seeding a thread's engine: a few words of
+		// std::random_device, the time, and an address of the calling
+		// thread's stack.
+		inline ext::seed_seq_fe<8> entropy() {
+			std::random_device rd{};
+			auto const t = static_cast<std::uint64_t>(
+				std::chrono::high_resolution_clock::now().time_since_epoch().count());
+			int local = 0;
+			auto const a = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&local));
+			return {
+				rd(), rd(), rd(), rd(),
+				static_cast<std::uint32_t>(t), static_cast<std::uint32_t>(t >> 32),
+				static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(a >> 32)
+			};
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -14,45 +14,153 @@
 #define STL2_DETAIL_RANDOM_HPP
 
 #include <cstdint>
-#include <initializer_list>
 #include <random>
-#include <stl2/random.hpp>
+#include <utility>
 #include <stl2/detail/fwd.hpp>
-#include <stl2/detail/meta.hpp>
-#include <stl2/detail/algorithm/generate.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+#include <stl2/detail/concepts/urng.hpp>
+#include <stl2/detail/random/engine.hpp>
+#include <stl2/detail/random/seed_seq.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// The default random engine [Implementation detail]
+//
+// shuffle and sample draw from a thread_local default_random_engine
+// seeded on first use from detail::random::entropy(). The engine is
+// xoshiro256**, whose 32 bytes of state are cheap to seed in each new
+// thread; define STL2_DEFAULT_RANDOM_ENGINE to another engine type to
+// override it.
+//
+#ifndef STL2_DEFAULT_RANDOM_ENGINE
+ #define STL2_DEFAULT_RANDOM_ENGINE ::__stl2::ext::xoshiro256starstar
+#endif
 
 STL2_OPEN_NAMESPACE {
 	namespace detail {
+		using default_random_engine = STL2_DEFAULT_RANDOM_ENGINE;
+		static_assert(UniformRandomNumberGenerator<default_random_engine>);
+
 		namespace random {
-			struct seeder // Brutal SeedSequence hack
-			{
-				using result_type = std::uint32_t;
-
-				seeder() = default;
-				seeder(std::initializer_list<result_type>) {}
-				template<InputIterator I, Sentinel<I> S>
-				seeder(I, S) {}
-
-				template<RandomAccessIterator I, SizedSentinel<I> S>
-				void generate(I first, S last) const {
-					std::random_device rd{};
-					__stl2::generate(first, last, std::ref(rd));
-				}
+			// G produces every 32- or 64-bit pattern with equal probability.
+			template<class G>
+			concept bool FullWordGenerator =
+				UniformRandomNumberGenerator<G> &&
+				G::min() == 0 &&
+				(G::max() == 0xffffffffu || G::max() == ~std::uint64_t{0});
 
-				static constexpr std::size_t size() noexcept { return ~std::size_t{0}; }
+			template<FullWordGenerator G>
+			inline std::uint64_t bits64(G& g) {
+				if constexpr (G::max() == ~std::uint64_t{0}) {
+					return g();
+				} else {
+					auto const hi = static_cast<std::uint64_t>(g());
+					return hi << 32 | static_cast<std::uint64_t>(g());
+				}
+			}
 
-				template<OutputIterator<result_type> I>
-				void param(I) noexcept {}
+			// The 128-bit product of two 64-bit words.
+			struct wide_product {
+				std::uint64_t hi;
+				std::uint64_t lo;
 			};
+
+			// a * b from the products of their 32-bit halves, for
+			// targets without a 128-bit integer type.
+			constexpr wide_product mul64_halves(std::uint64_t a, std::uint64_t b) noexcept {
+				constexpr std::uint64_t mask = 0xffffffff;
+				auto const ll = (a & mask) * (b & mask);
+				auto const lh = (a & mask) * (b >> 32);
+				auto const hl = (a >> 32) * (b & mask);
+				auto const hh = (a >> 32) * (b >> 32);
+				auto const mid = (ll >> 32) + (lh & mask) + (hl & mask);
+				return {hh + (lh >> 32) + (hl >> 32) + (mid >> 32), mid << 32 | (ll & mask)};
+			}
+
+			constexpr wide_product mul64(std::uint64_t a, std::uint64_t b) noexcept {
+#ifdef __SIZEOF_INT128__
+				auto const m = uint128_t{a} * b;
+				return {static_cast<std::uint64_t>(m >> 64), static_cast<std::uint64_t>(m)};
+#else
+				return random::mul64_halves(a, b);
+#endif
+			}
+
+			// A uniform integer in [0, s) for s > 0, by Lemire's nearly
+			// divisionless method: the high word of a 64x64-bit product,
+			// rejecting the (at most s - 1) low words that would bias it.
+			// The modulus is computed only when the first low word falls
+			// below s.
+			template<FullWordGenerator G>
+			std::uint64_t bounded(G& g, std::uint64_t s) {
+				STL2_EXPECT(s > 0);
+				auto m = random::mul64(random::bits64(g), s);
+				if (m.lo < s) {
+					auto const t = -s % s;
+					while (m.lo < t) {
+						m = random::mul64(random::bits64(g), s);
+					}
+				}
+				return m.hi;
+			}
+
+			// Independent uniform integers in [0, s1) and [0, s2) from a
+			// single 64-bit draw, for s1 * s2 <= 2^64 (Brackett-Rozinsky
+			// and Lemire, "Batched Ranged Random Integer Generation"). The
+			// low word of each product feeds the next; the draw is
+			// rejected as a whole if the final low word is biased.
+			template<FullWordGenerator G>
+			std::pair<std::uint64_t, std::uint64_t>
+			bounded2(G& g, std::uint64_t s1, std::uint64_t s2) {
+				STL2_EXPECT(s1 > 0 && s2 > 0);
+				STL2_EXPECT(random::mul64(s1, s2).hi == 0 ||
+					(random::mul64(s1, s2).hi == 1 && s1 * s2 == 0));
+				auto const p = s1 * s2; // 0 iff s1 * s2 == 2^64
+				for (;;) {
+					auto const m1 = random::mul64(random::bits64(g), s1);
+					auto const m2 = random::mul64(m1.lo, s2);
+					auto const l = m2.lo;
+					if (p == 0 || l >= p || l >= -p % p) {
+						return {m1.hi, m2.hi};
+					}
+				}
+			}
+		}
+
+		namespace random {
+			// A uniform double in (0, 1), never 0 so that its logarithm is
+			// finite.
+			template<UniformRandomNumberGenerator G>
+			double unit_open(G& g) {
+				if constexpr (FullWordGenerator<G>) {
+					return (static_cast<double>(random::bits64(g) >> 11) + 0.5) * 0x1p-53;
+				} else {
+					uniform_real_distribution<double> dist{0.0, 1.0};
+					double u;
+					do {
+						u = dist(g);
+					} while (u == 0.0);
+					return u;
+				}
+			}
+
+			// A uniform integer in [0, n) for n > 0.
+			template<UniformRandomNumberGenerator G, Integral D>
+			D uniform_below(G& g, D n) {
+				STL2_EXPECT(n > 0);
+				if constexpr (FullWordGenerator<G>) {
+					return static_cast<D>(random::bounded(g, static_cast<std::uint64_t>(n)));
+				} else {
+					using param_t = typename uniform_int_distribution<D>::param_type;
+					return uniform_int_distribution<D>{}(g, param_t{0, n - 1});
+				}
+			}
 		}
 
-		using default_random_engine =
-			meta::if_c<sizeof(void*) >= 8, std::mt19937_64, std::mt19937>;
 		template<class = void>
 		inline default_random_engine& get_random_engine()
 		{
 			thread_local default_random_engine engine = []{
-				random::seeder seed;
+				auto seed = random::entropy();
 				return default_random_engine{seed};
 			}();
 			return engine;
@@ -21,6 +21,7 @@
 #include <stl2/detail/concepts/core.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/unreachable.hpp>
 #include <stl2/detail/range/access.hpp>
 
 namespace std {
@@ -65,6 +66,11 @@ STL2_OPEN_NAMESPACE {
 			{ __stl2::size(r) } -> iter_difference_t<iterator_t<R>>;
 		};
 
+	// Extension: a range that never ends, like iota(0), so that the first
+	// n elements of it number n.
+	template<class R>
+	concept bool _UnboundedRange = Range<R> && Same<sentinel_t<R>, unreachable>;
+
 	///////////////////////////////////////////////////////////////////////////
 	// View [ranges.view]
 	//
@@ -0,0 +1,112 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_RANGE_FOR_EACH_WHILE_HPP
+#define STL2_DETAIL_RANGE_FOR_EACH_WHILE_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/functional/invoke.hpp>
+#include <stl2/detail/iterator/chunked.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Internal iteration [Extension]
+//
+// ext::for_each_while(r, sink) calls sink with each element of r in turn
+// until sink returns false, and returns whether it got to the end of r.
+// The adaptors in view/ customize it with a for_each_while found by ADL,
+// which passes their base's for_each_while a sink of their own that
+// filters, transforms or counts the elements on their way to the given
+// one. A stack of adaptors then runs as a single loop over the innermost
+// range, with the adaptors fused into its body, instead of through a
+// stack of iterators each testing for the end of the one below. Views
+// that only pass their base's elements along, like ref_view and
+// take_view, customize it only when their base does. The range overloads
+// of for_each, count, count_if, any_of, all_of, none_of and copy use it
+// whenever the range customizes it and its iterators have no faster
+// path of their own.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __for_each_while {
+		template<class R, class F>
+		concept bool has_customization =
+			requires(R& r, F& sink) {
+				{ for_each_while(r, sink) } -> bool;
+			};
+
+		// Stands in for the sink when asking whether a range customizes
+		// for_each_while at all.
+		struct probe {
+			template<class T>
+			constexpr bool operator()(T&&) const noexcept { return true; }
+		};
+
+		// Whether R has a for_each_while of its own, rather than the
+		// default loop.
+		template<class R>
+		concept bool customized = has_customization<R, probe>;
+
+		// Calls sink with the elements of [first, last) until it
+		// returns false.
+		template<InputIterator I, Sentinel<I> S, class F>
+		constexpr bool loop(I first, S last, F& sink) {
+			for (; first != last; ++first) {
+				if (!__stl2::invoke(sink, *first)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		struct __fn {
+			template<InputRange R, class F>
+			requires has_customization<R, remove_reference_t<F>>
+			constexpr bool operator()(R&& r, F&& sink) const {
+				return for_each_while(r, sink);
+			}
+			template<InputRange R, class F>
+			requires !has_customization<R, remove_reference_t<F>>
+			constexpr bool operator()(R&& r, F&& sink) const {
+				return __for_each_while::loop(__stl2::begin(r), __stl2::end(r), sink);
+			}
+		};
+	}
+
+	namespace ext {
+		// In an inline namespace, so that it doesn't clash with the
+		// customizations of the views in ext.
+		inline namespace __cpos {
+			inline constexpr __for_each_while::__fn for_each_while {};
+		}
+	}
+
+	namespace detail {
+		// Whether an algorithm does better to consume all of r through
+		// for_each_while than through its iterators: when r customizes
+		// it, and the iterators don't already reach one of the
+		// algorithm's fast paths. Those take sized random-access ranges,
+		// contiguous ones among them, whole; segmented and chunked
+		// iterators a block at a time; and hierarchical ones an inner
+		// range at a time.
+		template<class R>
+		concept bool InternallyIterable =
+			InputRange<R> &&
+			__for_each_while::customized<R> &&
+			!(RandomAccessRange<R> && SizedRange<R>) &&
+			!segmented::Segmentable<iterator_t<R>, sentinel_t<R>> &&
+			!chunked::Chunkable<iterator_t<R>, sentinel_t<R>> &&
+			!segmented::Hierarchical<iterator_t<R>, sentinel_t<R>>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,380 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_SIMD_HPP
+#define STL2_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+#include <stl2/detail/functional/comparisons.hpp>
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+ #define STL2_SIMD_X86 1
+ #include <immintrin.h>
+#else
+ #define STL2_SIMD_X86 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Vectorized search kernels [Implementation detail]
+//
+// find, count, equal and mismatch over contiguous ranges of arithmetic
+// elements, compared with == under the identity projection, reduce to
+// these kernels. Byte searches use memchr and memcmp. On x86, the
+// remaining cases use SSE2, or AVX2 when the CPU supports it; elsewhere
+// they are plain loops.
+//
+// The kernels are not constexpr, so callers must take the scalar path
+// during constant evaluation (see constant_evaluated below).
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail::simd {
+		template<class T>
+		concept bool Element =
+			_Is<T, std::is_arithmetic> && !Same<T, bool> &&
+			(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+			(Integral<T> || std::numeric_limits<T>::is_iec559);
+
+		template<class>
+		constexpr bool is_identity = false;
+		template<>
+		constexpr bool is_identity<identity> = true;
+		template<class T>
+		constexpr bool is_identity<std::reference_wrapper<T>> =
+			is_identity<std::remove_cv_t<T>>;
+
+		template<class, class>
+		constexpr bool is_equal_to = false;
+		template<class T>
+		constexpr bool is_equal_to<equal_to<>, T> = true;
+		template<class T>
+		constexpr bool is_equal_to<equal_to<T>, T> = true;
+		template<class T>
+		constexpr bool is_equal_to<std::equal_to<>, T> = true;
+		template<class T>
+		constexpr bool is_equal_to<std::equal_to<T>, T> = true;
+		template<class F, class T>
+		constexpr bool is_equal_to<std::reference_wrapper<F>, T> =
+			is_equal_to<std::remove_cv_t<F>, T>;
+
+		template<class I>
+		concept bool Contiguous =
+			ContiguousIterator<I> && Element<iter_value_t<I>> &&
+			!_Is<std::remove_reference_t<iter_reference_t<I>>, std::is_volatile>;
+
+		// find(first, last, value, proj) and count(...) can use the
+		// kernels.
+		template<class I, class S, class T, class Proj>
+		concept bool Searchable =
+			Contiguous<I> && SizedSentinel<S, I> &&
+			Same<__uncvref<T>, iter_value_t<I>> && is_identity<Proj>;
+
+		// equal(first1, ..., pred, proj1, proj2) and mismatch(...) can use
+		// the kernels.
+		template<class I1, class I2, class Pred, class Proj1, class Proj2>
+		concept bool Comparable =
+			Contiguous<I1> && Contiguous<I2> && Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			is_equal_to<Pred, iter_value_t<I1>> && is_identity<Proj1> && is_identity<Proj2>;
+
+		// The address of the first element of [i, i + n), or nullptr if the
+		// range is empty and so i may not be dereferenceable.
+		template<ContiguousIterator I>
+		auto data(const I& i, iter_difference_t<I> n)
+		noexcept(noexcept(ext::to_address(i)))
+		{
+			return n > 0 ? ext::to_address(i) : nullptr;
+		}
+
+		// Whether [i, i + n) is being constant evaluated, so the kernels
+		// must not run. Without STL2_IS_CONSTANT_EVALUATED (GCC before 9),
+		// __builtin_constant_p stands in for it as in those compilers'
+		// char_traits: it holds of every element during constant
+		// evaluation, and at run time only of elements the optimizer
+		// already knows, for which the scalar loop does as well.
+		template<ContiguousIterator I>
+		constexpr bool constant_evaluated(const I& i, iter_difference_t<I> n) {
+#if defined(STL2_IS_CONSTANT_EVALUATED)
+			(void)i; (void)n;
+			return STL2_IS_CONSTANT_EVALUATED();
+#elif defined(__GNUC__)
+			if (!__builtin_constant_p(n)) {
+				return false;
+			}
+			auto const p = ext::to_address(i);
+			for (iter_difference_t<I> k = 0; k < n; ++k) {
+				if (!__builtin_constant_p(p[k])) {
+					return false;
+				}
+			}
+			return true;
+#else
+			(void)i; (void)n;
+			return true;
+#endif
+		}
+
+#if STL2_SIMD_X86
+		inline unsigned count_trailing_zeros(unsigned mask) noexcept {
+			return static_cast<unsigned>(__builtin_ctz(mask));
+		}
+
+		// Each ISA compares 'width' bytes at a time. eq<T>(p, value) and
+		// eq<T>(p, q) compare the elements at p elementwise to value or to
+		// the elements at q, and return a mask with sizeof(T) bits set per
+		// equal element. Only pointers, scalars and masks cross these
+		// function boundaries, so they're safe to call from code compiled
+		// for any ISA.
+		struct sse2 {
+			static constexpr std::ptrdiff_t width = 16;
+
+			template<class T>
+			static __m128i broadcast(T t) noexcept {
+				if constexpr (sizeof(T) == 1) {
+					std::int8_t i; std::memcpy(&i, &t, 1);
+					return _mm_set1_epi8(i);
+				} else if constexpr (sizeof(T) == 2) {
+					std::int16_t i; std::memcpy(&i, &t, 2);
+					return _mm_set1_epi16(i);
+				} else if constexpr (sizeof(T) == 4) {
+					std::int32_t i; std::memcpy(&i, &t, 4);
+					return _mm_set1_epi32(i);
+				} else {
+					std::int64_t i; std::memcpy(&i, &t, 8);
+					return _mm_set1_epi64x(i);
+				}
+			}
+			template<class T>
+			static unsigned compare(__m128i a, __m128i b) noexcept {
+				__m128i r;
+				if constexpr (Same<T, float>) {
+					r = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+				} else if constexpr (Same<T, double>) {
+					r = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+				} else if constexpr (sizeof(T) == 1) {
+					r = _mm_cmpeq_epi8(a, b);
+				} else if constexpr (sizeof(T) == 2) {
+					r = _mm_cmpeq_epi16(a, b);
+				} else if constexpr (sizeof(T) == 4) {
+					r = _mm_cmpeq_epi32(a, b);
+				} else {
+					// SSE2 has no 64-bit compare: both halves must match.
+					r = _mm_cmpeq_epi32(a, b);
+					r = _mm_and_si128(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(2, 3, 0, 1)));
+				}
+				return static_cast<unsigned>(_mm_movemask_epi8(r));
+			}
+			template<class T>
+			static unsigned eq(const T* p, T value) noexcept {
+				return sse2::compare<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+					sse2::broadcast(value));
+			}
+			template<class T>
+			static unsigned eq(const T* p, const T* q) noexcept {
+				return sse2::compare<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(q)));
+			}
+		};
+
+		struct avx2 {
+			static constexpr std::ptrdiff_t width = 32;
+
+			template<class T>
+			__attribute__((target("avx2")))
+			static unsigned eq(const T* p, T value) noexcept {
+				__m256i v;
+				if constexpr (sizeof(T) == 1) {
+					std::int8_t i; std::memcpy(&i, &value, 1);
+					v = _mm256_set1_epi8(i);
+				} else if constexpr (sizeof(T) == 2) {
+					std::int16_t i; std::memcpy(&i, &value, 2);
+					v = _mm256_set1_epi16(i);
+				} else if constexpr (sizeof(T) == 4) {
+					std::int32_t i; std::memcpy(&i, &value, 4);
+					v = _mm256_set1_epi32(i);
+				} else {
+					std::int64_t i; std::memcpy(&i, &value, 8);
+					v = _mm256_set1_epi64x(i);
+				}
+				return avx2::compare<T>(p, v);
+			}
+			template<class T>
+			__attribute__((target("avx2")))
+			static unsigned eq(const T* p, const T* q) noexcept {
+				return avx2::compare<T>(p, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q)));
+			}
+
+		private:
+			template<class T>
+			__attribute__((target("avx2"), always_inline))
+			static inline unsigned compare(const T* p, __m256i b) noexcept {
+				auto const a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				__m256i r;
+				if constexpr (Same<T, float>) {
+					r = _mm256_castps_si256(_mm256_cmp_ps(
+						_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+				} else if constexpr (Same<T, double>) {
+					r = _mm256_castpd_si256(_mm256_cmp_pd(
+						_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+				} else if constexpr (sizeof(T) == 1) {
+					r = _mm256_cmpeq_epi8(a, b);
+				} else if constexpr (sizeof(T) == 2) {
+					r = _mm256_cmpeq_epi16(a, b);
+				} else if constexpr (sizeof(T) == 4) {
+					r = _mm256_cmpeq_epi32(a, b);
+				} else {
+					r = _mm256_cmpeq_epi64(a, b);
+				}
+				return static_cast<unsigned>(_mm256_movemask_epi8(r));
+			}
+		};
+
+		inline bool has_avx2() noexcept {
+#if defined(__AVX2__)
+			return true;
+#else
+			static const bool b = [] {
+				__builtin_cpu_init();
+				return __builtin_cpu_supports("avx2") != 0;
+			}();
+			return b;
+#endif
+		}
+
+		// The generic kernels. Each ISA instantiates them from an entry
+		// point compiled for that ISA, which inlines everything.
+		template<class V, Element T>
+		inline const T* find_impl(const T* first, const T* last, T value) noexcept {
+			constexpr std::ptrdiff_t n = V::width / sizeof(T);
+			for (; last - first >= n; first += n) {
+				if (auto const m = V::template eq<T>(first, value)) {
+					return first + simd::count_trailing_zeros(m) / sizeof(T);
+				}
+			}
+			for (; first != last && !(*first == value); ++first) {}
+			return first;
+		}
+
+		template<class V, Element T>
+		inline std::ptrdiff_t count_impl(const T* first, const T* last, T value) noexcept {
+			constexpr std::ptrdiff_t n = V::width / sizeof(T);
+			std::ptrdiff_t bits = 0;
+			for (; last - first >= n; first += n) {
+				bits += __builtin_popcount(V::template eq<T>(first, value));
+			}
+			auto result = bits / static_cast<std::ptrdiff_t>(sizeof(T));
+			for (; first != last; ++first) {
+				result += *first == value;
+			}
+			return result;
+		}
+
+		template<class V, Element T>
+		inline std::ptrdiff_t mismatch_impl(const T* a, const T* b, std::ptrdiff_t len) noexcept {
+			constexpr std::ptrdiff_t n = V::width / sizeof(T);
+			constexpr unsigned all = V::width == 32 ? ~0u : (1u << V::width) - 1;
+			std::ptrdiff_t i = 0;
+			for (; len - i >= n; i += n) {
+				auto const m = V::template eq<T>(a + i, b + i);
+				if (m != all) {
+					return i + simd::count_trailing_zeros(~m) / sizeof(T);
+				}
+			}
+			for (; i != len && a[i] == b[i]; ++i) {}
+			return i;
+		}
+
+		template<Element T>
+		__attribute__((target("avx2"), flatten))
+		const T* find_avx2(const T* first, const T* last, T value) noexcept {
+			return simd::find_impl<avx2>(first, last, value);
+		}
+		template<Element T>
+		__attribute__((target("avx2"), flatten))
+		std::ptrdiff_t count_avx2(const T* first, const T* last, T value) noexcept {
+			return simd::count_impl<avx2>(first, last, value);
+		}
+		template<Element T>
+		__attribute__((target("avx2"), flatten))
+		std::ptrdiff_t mismatch_avx2(const T* a, const T* b, std::ptrdiff_t n) noexcept {
+			return simd::mismatch_impl<avx2>(a, b, n);
+		}
+#endif // STL2_SIMD_X86
+
+		template<Element T>
+		const T* find(const T* first, const T* last, T value) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				if (first == last) {
+					return last;
+				}
+				auto const p = std::memchr(first, static_cast<unsigned char>(value), last - first);
+				return p ? static_cast<const T*>(p) : last;
+			} else {
+#if STL2_SIMD_X86
+				return simd::has_avx2() ? simd::find_avx2(first, last, value)
+					: simd::find_impl<sse2>(first, last, value);
+#else
+				for (; first != last && !(*first == value); ++first) {}
+				return first;
+#endif
+			}
+		}
+
+		template<Element T>
+		std::ptrdiff_t count(const T* first, const T* last, T value) noexcept {
+#if STL2_SIMD_X86
+			return simd::has_avx2() ? simd::count_avx2(first, last, value)
+				: simd::count_impl<sse2>(first, last, value);
+#else
+			std::ptrdiff_t result = 0;
+			for (; first != last; ++first) {
+				result += *first == value;
+			}
+			return result;
+#endif
+		}
+
+		// Returns the index of the first position at which [a, a + n) and
+		// [b, b + n) differ, or n.
+		template<Element T>
+		std::ptrdiff_t mismatch(const T* a, const T* b, std::ptrdiff_t n) noexcept {
+#if STL2_SIMD_X86
+			return simd::has_avx2() ? simd::mismatch_avx2(a, b, n)
+				: simd::mismatch_impl<sse2>(a, b, n);
+#else
+			std::ptrdiff_t i = 0;
+			for (; i != n && a[i] == b[i]; ++i) {}
+			return i;
+#endif
+		}
+
+		template<Element T>
+		bool equal(const T* a, const T* b, std::ptrdiff_t n) noexcept {
+			if constexpr (Integral<T>) {
+				// Integers compare equal exactly when their representations do.
+				return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+			} else {
+				return simd::mismatch(a, b, n) == n;
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -15,5 +15,8 @@
 #include <random>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/urng.hpp>
+#include <stl2/detail/random/engine.hpp>
+#include <stl2/detail/random/reservoir.hpp>
+#include <stl2/detail/random/seed_seq.hpp>
 
 #endif
@@ -0,0 +1,147 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_ANY_HPP
+#define STL2_VIEW_ANY_HPP
+
+#include <cstddef>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/any_iterator.hpp>
+#include <stl2/detail/iterator/chunked.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// A view of any range whose reference type converts to Reference.
+		// Category is input_iterator_tag or forward_iterator_tag, the
+		// category of the view's iterators. The erased view and its
+		// iterators are stored in place when they fit in BufferSize bytes,
+		// as with basic_any_input_iterator.
+		//
+		// The iterators are ChunkedIterators when the values are
+		// Semiregular and assignable from Reference: copy, count and
+		// for_each then pull a view's elements a chunk at a time, with one
+		// indirect call per chunk rather than several per element.
+		template<class Reference, class Category,
+			std::size_t BufferSize = 2 * sizeof(void *),
+			bool ThreadSafe = true>
+		requires
+			Same<Category, input_iterator_tag> ||
+			Same<Category, forward_iterator_tag>
+		class basic_any_view
+		: public view_interface<basic_any_view<Reference, Category, BufferSize, ThreadSafe>> {
+			using iterator = basic_iterator<__any_iterator::cursor<
+				Reference, __uncvref<Reference>, __iter_move::rvalue<Reference>,
+				BufferSize, ThreadSafe, Same<Category, forward_iterator_tag>, true>>;
+			using blob_t = __any_iterator::blob<BufferSize>;
+
+			struct vtable {
+				void (*copy)(blob_t const &, blob_t &);
+				void (*move)(blob_t &, blob_t &);
+				void (*nuke)(blob_t &) noexcept;
+				iterator (*begin)(blob_t &);
+			};
+
+			template<class V>
+			struct view_ops {
+				using obj = __any_iterator::object<V, BufferSize, ThreadSafe>;
+
+				static iterator begin(blob_t &b) {
+					using C = __any_iterator::bounded_cursor<iterator_t<V>, sentinel_t<V>>;
+					auto &v = obj::get(b);
+					return iterator{basic_iterator<C>{C{__stl2::begin(v), __stl2::end(v)}}};
+				}
+
+				static constexpr vtable table = {
+					&obj::copy, &obj::move, &obj::nuke, &begin
+				};
+			};
+
+			static void copy_empty(blob_t const &, blob_t &) {}
+			static void move_empty(blob_t &, blob_t &) {}
+			static void nuke_empty(blob_t &) noexcept {}
+			static iterator begin_empty(blob_t &) { return iterator{}; }
+			static constexpr vtable empty_table = {
+				&copy_empty, &move_empty, &nuke_empty, &begin_empty
+			};
+
+			blob_t data_ = { nullptr };
+			vtable const *vt_ = &empty_table;
+		public:
+			basic_any_view() = default;
+
+			template<InputRange R>
+			requires
+				!Same<__uncvref<R>, basic_any_view> &&
+				ViewableRange<R> &&
+				(Same<Category, input_iterator_tag> || ForwardRange<R>) &&
+				ConvertibleTo<iter_reference_t<iterator_t<all_view<R>>>, Reference>
+			basic_any_view(R &&r) {
+				using V = all_view<R>;
+				__any_iterator::object<V, BufferSize, ThreadSafe>::make(
+					data_, view::all(std::forward<R>(r)));
+				vt_ = &view_ops<V>::table;
+			}
+
+			basic_any_view(basic_any_view const &that) {
+				that.vt_->copy(that.data_, data_);
+				vt_ = that.vt_;
+			}
+			basic_any_view(basic_any_view &&that) {
+				that.vt_->move(that.data_, data_);
+				vt_ = __stl2::exchange(that.vt_, &empty_table);
+			}
+			basic_any_view &operator=(basic_any_view const &that) {
+				if (&that != this) {
+					__stl2::exchange(vt_, &empty_table)->nuke(data_);
+					that.vt_->copy(that.data_, data_);
+					vt_ = that.vt_;
+				}
+				return *this;
+			}
+			basic_any_view &operator=(basic_any_view &&that) {
+				if (&that != this) {
+					__stl2::exchange(vt_, &empty_table)->nuke(data_);
+					that.vt_->move(that.data_, data_);
+					vt_ = __stl2::exchange(that.vt_, &empty_table);
+				}
+				return *this;
+			}
+			~basic_any_view() {
+				vt_->nuke(data_);
+			}
+
+			iterator begin() {
+				return vt_->begin(data_);
+			}
+			default_sentinel end() const noexcept {
+				return {};
+			}
+		};
+
+		template<class Reference, class Category = input_iterator_tag>
+		using any_view = basic_any_view<Reference, Category>;
+
+		template<class Reference,
+			std::size_t BufferSize = 2 * sizeof(void *),
+			bool ThreadSafe = true>
+		using any_input_view =
+			basic_any_view<Reference, input_iterator_tag, BufferSize, ThreadSafe>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,133 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_CACHE1_HPP
+#define STL2_VIEW_CACHE1_HPP
+
+#include <memory>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/non_propagating_cache.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// The elements of R, each read from R once however many times it
+		// is dereferenced: the current element is kept in the view until
+		// the iterator moves on. In
+		//
+		//   rng | view::transform(f) | view::ext::cache1 | view::filter(pred)
+		//
+		// f is called once per element rather than once for pred and again
+		// for whoever reads the elements pred accepts. There is one cache
+		// for the view, so it is an input range whatever R is. When R's
+		// elements are lvalues the cache holds the address of the current
+		// one rather than a copy, so that writes reach R.
+		template<View R>
+		requires
+			InputRange<R> &&
+			Constructible<iter_value_t<iterator_t<R>>, iter_reference_t<iterator_t<R>>>
+		class cache1_view : public view_interface<cache1_view<R>> {
+			using V = iter_value_t<iterator_t<R>>;
+			using Ref = iter_reference_t<iterator_t<R>>;
+			static constexpr bool by_address = std::is_lvalue_reference_v<Ref>;
+			using cached_t = meta::if_c<by_address, std::remove_reference_t<Ref>*, V>;
+			using reference = meta::if_c<by_address, Ref, V&>;
+
+			struct sentinel {
+				sentinel_t<R> end_;
+			};
+
+			struct cursor {
+				using value_type = V;
+				using difference_type = iter_difference_t<iterator_t<R>>;
+				using single_pass = std::true_type;
+
+				cache1_view* parent_ = nullptr;
+				iterator_t<R> current_{};
+
+				constexpr reference read() const {
+					auto& cache = parent_->cache_;
+					if (!cache) {
+						if constexpr (by_address) {
+							cache.emplace(std::addressof(*current_));
+						} else {
+							cache.emplace(*current_);
+						}
+					}
+					if constexpr (by_address) {
+						return **cache;
+					} else {
+						return *cache;
+					}
+				}
+				constexpr std::remove_reference_t<reference>&& indirect_move() const
+				{ return std::move(read()); }
+
+				constexpr void next() {
+					++current_;
+					parent_->cache_.reset();
+				}
+
+				constexpr bool equal(const sentinel& s) const
+				{ return current_ == s.end_; }
+			};
+
+			R base_;
+			detail::non_propagating_cache<cached_t> cache_;
+		public:
+			cache1_view() = default;
+
+			constexpr explicit cache1_view(R base)
+			: base_(std::move(base)) {}
+
+			constexpr R base() const { return base_; }
+
+			constexpr auto begin() {
+				cache_.reset();
+				return basic_iterator<cursor>{cursor{this, __stl2::begin(base_)}};
+			}
+			constexpr sentinel end()
+			{ return sentinel{__stl2::end(base_)}; }
+
+			constexpr auto size() requires !SizedRange<const R> && SizedRange<R>
+			{ return __stl2::size(base_); }
+			constexpr auto size() const requires SizedRange<const R>
+			{ return __stl2::size(base_); }
+		};
+
+		template<Range R>
+		cache1_view(R&&) -> cache1_view<all_view<R>>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __cache1_fn : detail::__pipeable<__cache1_fn> {
+			template<InputRange Rng>
+			requires
+				ViewableRange<Rng> &&
+				Constructible<iter_value_t<iterator_t<Rng>>, iter_reference_t<iterator_t<Rng>>>
+			constexpr auto operator()(Rng&& rng) const {
+				return __stl2::ext::cache1_view{all(std::forward<Rng>(rng))};
+			}
+		};
+
+		inline constexpr __cache1_fn cache1 {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,117 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_CHUNK_HPP
+#define STL2_VIEW_CHUNK_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/stride.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		namespace __chunk {
+			// The elements of [first, last) as a range: a span when they
+			// are contiguous, otherwise a subrange.
+			template<ForwardIterator I>
+			constexpr auto block(I first, I last) {
+				if constexpr (ContiguousIterator<I>) {
+					using T = remove_reference_t<iter_reference_t<I>>;
+					return span<T>{ext::to_address(first), last - first};
+				} else {
+					return subrange<I>{std::move(first), std::move(last)};
+				}
+			}
+		}
+
+		// R cut into consecutive blocks of n elements; the last block is
+		// short when n doesn't divide the size of R. The blocks of a
+		// contiguous R are spans, so that a kernel over a block sees
+		// pointers it can vectorize.
+		template<View R>
+		requires ForwardRange<R>
+		class chunk_view : public view_interface<chunk_view<R>> {
+			using D = iter_difference_t<iterator_t<R>>;
+
+			template<bool IsConst>
+			struct cursor : __stride::position<__maybe_const<IsConst, R>> {
+				constexpr auto read() const {
+					return __chunk::block(this->current_,
+						__stl2::next(this->current_, this->stride_, this->end_));
+				}
+			};
+
+			R base_;
+			D size_ = 1;
+		public:
+			chunk_view() = default;
+
+			constexpr chunk_view(R base, D size)
+			: base_(std::move(base)), size_(size)
+			{ STL2_EXPECT(0 < size); }
+
+			template<ViewableRange O>
+			requires _ConstructibleFromRange<R, O>
+			constexpr chunk_view(O&& o, D size)
+			: base_(view::all(std::forward<O>(o))), size_(size)
+			{ STL2_EXPECT(0 < size); }
+
+			constexpr R base() const { return base_; }
+			constexpr D chunk_size() const noexcept { return size_; }
+
+			constexpr auto begin() requires !Range<const R>
+			{ return basic_iterator<cursor<false>>{cursor<false>{{__stl2::begin(base_), __stl2::end(base_), size_, 0}}}; }
+			constexpr auto begin() const requires Range<const R>
+			{ return basic_iterator<cursor<true>>{cursor<true>{{__stl2::begin(base_), __stl2::end(base_), size_, 0}}}; }
+
+			constexpr auto end() requires !Range<const R>
+			{ return __stride::end<cursor<false>>(base_, size_); }
+			constexpr auto end() const requires Range<const R>
+			{ return __stride::end<cursor<true>>(base_, size_); }
+
+			constexpr auto size() requires !Range<const R> && SizedRange<R>
+			{ return __stride::size(base_, size_); }
+			constexpr auto size() const requires SizedRange<const R>
+			{ return __stride::size(base_, size_); }
+		};
+
+		template<Range R>
+		chunk_view(R&&, iter_difference_t<iterator_t<R>>) -> chunk_view<all_view<R>>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __chunk_fn {
+			template<Range Rng>
+			constexpr auto operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> size) const
+			STL2_NOEXCEPT_REQUIRES_RETURN(
+				__stl2::ext::chunk_view{all(std::forward<Rng>(rng)), size}
+			)
+
+			template<Integral D>
+			constexpr auto operator()(D size) const
+			{ return detail::view_closure{*this, static_cast<D>(size)}; }
+		};
+
+		inline constexpr __chunk_fn chunk {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -17,6 +17,7 @@
 #include <stl2/detail/iterator/common_iterator.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -70,6 +71,17 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr auto size() const requires SizedRange<const Rng>
 		{ return __stl2::size(rng_); }
+
+		// Extension: internal iteration
+		template<class Sink>
+		requires __for_each_while::customized<Rng>
+		friend constexpr bool for_each_while(common_view& self, Sink& sink)
+		{ return __stl2::ext::for_each_while(self.rng_, sink); }
+
+		template<class Sink>
+		requires Range<const Rng> && __for_each_while::customized<const Rng>
+		friend constexpr bool for_each_while(const common_view& self, Sink& sink)
+		{ return __stl2::ext::for_each_while(self.rng_, sink); }
 	};
 
 	template<class O>
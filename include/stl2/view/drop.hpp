@@ -20,6 +20,7 @@
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/range/nth_iterator.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
@@ -61,6 +62,17 @@ STL2_OPEN_NAMESPACE {
 
 			constexpr auto size() requires !SimpleView<R> && SizedRange<R> { return size_impl(*this); }
 			constexpr auto size() const requires SizedRange<const R> { return size_impl(*this); }
+
+			// Extension: internal iteration
+			template<class Sink>
+			requires __for_each_while::customized<R>
+			friend constexpr bool for_each_while(drop_view& self, Sink& sink)
+			{ return for_each_while_impl(self, sink); }
+
+			template<class Sink>
+			requires RandomAccessRange<const R> && __for_each_while::customized<const R>
+			friend constexpr bool for_each_while(const drop_view& self, Sink& sink)
+			{ return for_each_while_impl(self, sink); }
 		private:
 			R base_;
 			D count_;
@@ -83,6 +95,23 @@ STL2_OPEN_NAMESPACE {
 			template<class X>
 			static constexpr auto end_impl(X& x) { return __stl2::end(x.base_); }
 
+			template<class X, class Sink>
+			static constexpr bool for_each_while_impl(X& x, Sink& sink) {
+				if constexpr (RandomAccessRange<__maybe_const<is_const_v<X>, R>>) {
+					// Skipping the prefix is cheaper than fusing with the base.
+					return __for_each_while::loop(begin_impl(x), end_impl(x), sink);
+				} else {
+					auto n = x.count_;
+					return __stl2::ext::for_each_while(x.base_, [&](auto&& e) -> bool {
+						if (n > 0) {
+							--n;
+							return true;
+						}
+						return __stl2::invoke(sink, std::forward<decltype(e)>(e));
+					});
+				}
+			}
+
 			template<class X>
 			static constexpr auto size_impl(X& x) {
 				auto const size = __stl2::size(x.base_);
@@ -21,6 +21,7 @@
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <utility>
@@ -69,6 +70,22 @@ STL2_OPEN_NAMESPACE {
 			}
 
 			constexpr auto end() { return __stl2::end(base_); }
+
+			// Extension: internal iteration
+			template<class Sink>
+			friend constexpr bool for_each_while(drop_while_view& self, Sink& sink) {
+				auto& pred = self.get();
+				bool dropping = true;
+				return __stl2::ext::for_each_while(self.base_, [&](auto&& x) -> bool {
+					if (dropping) {
+						if (__stl2::invoke(pred, x)) {
+							return true;
+						}
+						dropping = false;
+					}
+					return __stl2::invoke(sink, std::forward<decltype(x)>(x));
+				});
+			}
 		private:
 			R base_;
 		};
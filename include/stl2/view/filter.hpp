@@ -20,6 +20,7 @@
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -60,6 +61,16 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr __iterator end() requires CommonRange<R>
 		{ return __iterator{*this, __stl2::end(base_)}; }
+
+		// Extension: internal iteration
+		template<class Sink>
+		friend constexpr bool for_each_while(filter_view& self, Sink& sink) {
+			auto& pred = self.pred_.get();
+			return __stl2::ext::for_each_while(self.base_, [&](auto&& x) -> bool {
+				return !__stl2::invoke(pred, x) ||
+					__stl2::invoke(sink, std::forward<decltype(x)>(x));
+			});
+		}
 	};
 
 	template<class R, class Pred>
@@ -156,7 +167,7 @@ STL2_OPEN_NAMESPACE {
 	public:
 		__sentinel() = default;
 		explicit constexpr __sentinel(filter_view& parent)
-		: end_(__stl2::end(parent)) {}
+		: end_(__stl2::end(parent.base_)) {}
 
 		constexpr sentinel_t<R> base() const
 		{ return end_; }
@@ -18,6 +18,7 @@
 #include <stl2/detail/iterator/concepts.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
 
@@ -105,6 +106,24 @@ STL2_OPEN_NAMESPACE {
 			auto size() const
 			requires SizedRange<Rng const>
 			{ return __stl2::size(get()); }
+
+			// Extension: internal iteration
+			template<class Sink>
+			requires !Range<Rng const> && __for_each_while::customized<Rng>
+			friend constexpr bool for_each_while(indirect_view& self, Sink& sink)
+			{ return for_each_while_impl(self.get(), sink); }
+
+			template<class Sink>
+			requires Range<Rng const> && __for_each_while::customized<Rng const>
+			friend constexpr bool for_each_while(const indirect_view& self, Sink& sink)
+			{ return for_each_while_impl(self.get(), sink); }
+		private:
+			template<class R, class Sink>
+			static constexpr bool for_each_while_impl(R& rng, Sink& sink) {
+				return __stl2::ext::for_each_while(rng, [&](auto&& x) -> bool {
+					return __stl2::invoke(sink, *x);
+				});
+			}
 		};
 
 		template<class Rng>
@@ -64,6 +64,9 @@ STL2_OPEN_NAMESPACE {
 		{ return sentinel{bound_}; }
 		constexpr iterator end() const requires Same<I, Bound>
 		{ return iterator{bound_}; }
+		// Unbounded, as repeat_view is, so that adaptors can tell.
+		constexpr unreachable end() const requires Same<Bound, unreachable>
+		{ return {}; }
 
 		template<class II = I, class BB = Bound> // gcc_bugs_bugs_bugs
 		constexpr auto size() const
@@ -18,6 +18,8 @@
 #include <stl2/detail/raw_ptr.hpp>
 #include <stl2/detail/semiregular_box.hpp>
 #include <stl2/detail/iostream/concepts.hpp>
+#include <stl2/detail/iostream/extract.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
 #include <stl2/detail/memory/addressof.hpp>
 #include <stl2/view/view_interface.hpp>
 
@@ -31,9 +33,17 @@ STL2_OPEN_NAMESPACE {
 
 			detail::raw_ptr<std::istream> sin_ = nullptr;
 			Val obj_ {};
+			bool fast_ = false;
 
-			void next_()
-			{ *sin_ >> obj_; }
+			void next_() {
+				if constexpr (detail::StreamedNumber<Val>) {
+					if (fast_) {
+						detail::extract::extract(*sin_, obj_);
+						return;
+					}
+				}
+				*sin_ >> obj_;
+			}
 		public:
 			istream_view() = default;
 			explicit constexpr istream_view(std::istream& sin)
@@ -41,6 +51,9 @@ STL2_OPEN_NAMESPACE {
 			: sin_{detail::addressof(sin)} {}
 
 			__iterator begin() {
+				if constexpr (detail::StreamedNumber<Val>) {
+					fast_ = detail::extract::applies(*sin_);
+				}
 				next_(); // prime the pump
 				return __iterator{*this};
 			}
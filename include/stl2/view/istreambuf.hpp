@@ -0,0 +1,165 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_ISTREAMBUF_HPP
+#define STL2_VIEW_ISTREAMBUF_HPP
+
+#include <climits>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/raw_ptr.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/detail/concepts/fundamental.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// The characters of a streambuf, like istreambuf_iterator. Its
+		// iterator is a SegmentedIterator whose segments are the
+		// streambuf's get area, so copy, find and count work through the
+		// buffer directly and call the streambuf only to refill it.
+		template<class charT, class traits = std::char_traits<charT>>
+		requires
+			SignedIntegral<typename traits::off_type>
+		class istreambuf_view
+		: public view_interface<istreambuf_view<charT, traits>> {
+		public:
+			using streambuf_type = std::basic_streambuf<charT, traits>;
+			using istream_type = std::basic_istream<charT, traits>;
+		private:
+			// basic_streambuf keeps its get area protected.
+			struct get_area : streambuf_type {
+				static charT *first(streambuf_type &s) {
+					return (s.*&get_area::gptr)();
+				}
+				static charT *last(streambuf_type &s) {
+					return (s.*&get_area::egptr)();
+				}
+				static void bump(streambuf_type &s, int n) {
+					(s.*&get_area::gbump)(n);
+				}
+			};
+
+			class cursor {
+				detail::raw_ptr<streambuf_type> sbuf_ = nullptr;
+				// The one character an unbuffered streambuf has in hand.
+				mutable charT ch_{};
+
+				bool at_end() const {
+					return !sbuf_ || traits::eq_int_type(sbuf_->sgetc(), traits::eof());
+				}
+			public:
+				using value_type = charT;
+				using difference_type = typename traits::off_type;
+				using single_pass = std::true_type;
+
+				struct mixin : basic_mixin<cursor> {
+				private:
+					using base_t = basic_mixin<cursor>;
+				public:
+					using base_t::base_t;
+
+					span<const charT> segment() const {
+						return base_t::get().segment();
+					}
+					void consume(difference_type n) {
+						base_t::get().consume(n);
+					}
+				};
+
+				cursor() = default;
+				explicit cursor(streambuf_type *sbuf) noexcept
+				: sbuf_{sbuf}
+				{}
+
+				charT read() const {
+					STL2_EXPECT(!at_end());
+					return traits::to_char_type(sbuf_->sgetc());
+				}
+				void next() {
+					STL2_EXPECT(!at_end());
+					sbuf_->sbumpc();
+				}
+				bool equal(default_sentinel) const {
+					return at_end();
+				}
+
+				span<const charT> segment() const {
+					if (at_end()) {
+						return {};
+					}
+					auto const first = get_area::first(*sbuf_);
+					auto const last = get_area::last(*sbuf_);
+					if (first != last) {
+						return {first, last};
+					}
+					ch_ = traits::to_char_type(sbuf_->sgetc());
+					return {&ch_, 1};
+				}
+				void consume(difference_type n) {
+					STL2_EXPECT(n >= 0);
+					if (n == 0) {
+						return;
+					}
+					auto avail = get_area::last(*sbuf_) - get_area::first(*sbuf_);
+					if (avail == 0) {
+						STL2_EXPECT(n == 1);
+						sbuf_->sbumpc();
+						return;
+					}
+					STL2_EXPECT(n <= avail);
+					for (; n > INT_MAX; n -= INT_MAX) {
+						get_area::bump(*sbuf_, INT_MAX);
+					}
+					get_area::bump(*sbuf_, static_cast<int>(n));
+				}
+			};
+
+			detail::raw_ptr<streambuf_type> sbuf_ = nullptr;
+		public:
+			using iterator = basic_iterator<cursor>;
+
+			istreambuf_view() = default;
+			explicit istreambuf_view(streambuf_type *sbuf) noexcept
+			: sbuf_{sbuf}
+			{}
+			explicit istreambuf_view(istream_type &sin) noexcept
+			: sbuf_{sin.rdbuf()}
+			{}
+
+			iterator begin() const {
+				return iterator{cursor{sbuf_}};
+			}
+			default_sentinel end() const noexcept {
+				return {};
+			}
+		};
+	}
+
+	namespace view {
+		struct __istreambuf_fn {
+			template<class charT, class traits>
+			__stl2::ext::istreambuf_view<charT, traits>
+			operator()(std::basic_istream<charT, traits> &sin) const noexcept {
+				return __stl2::ext::istreambuf_view<charT, traits>{sin};
+			}
+		};
+
+		inline constexpr __istreambuf_fn istreambuf {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,13 +13,16 @@
 #define STL2_VIEW_JOIN_HPP
 
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/span.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 
+#include <cstddef>
 #include <type_traits>
 
 STL2_OPEN_NAMESPACE {
@@ -48,6 +51,21 @@ STL2_OPEN_NAMESPACE {
 		template<InputRange InnerRng>
 		requires std::is_reference_v<InnerRng>
 		struct join_view_base<InnerRng> {};
+
+		// The number of elements of every R, when that is part of its type:
+		// the extent of an array, std::array or fixed-extent span, or the
+		// static size() of a range like single_view; -1 otherwise.
+		template<class R>
+		inline constexpr std::ptrdiff_t static_size = -1;
+		template<class R>
+		requires requires { ext::__span::static_extent<R>::value; }
+		inline constexpr std::ptrdiff_t static_size<R> = ext::__span::static_extent<R>::value;
+		template<class R>
+		requires requires { std::integral_constant<std::ptrdiff_t, R::size()>{}; }
+		inline constexpr std::ptrdiff_t static_size<R> = R::size();
+
+		template<class R>
+		concept bool StaticallySized = static_size<__uncvref<R>> >= 0;
 	}
 
 	template<InputRange Rng>
@@ -115,6 +133,47 @@ STL2_OPEN_NAMESPACE {
 			CommonRange<ConstRng> &&
 			CommonRange<iter_reference_t<iterator_t<ConstRng>>>
 		{ return {*this, __stl2::end(base_)}; }
+
+		// Extension: the size when that of the outer range is known and each
+		// inner range's is fixed by its type.
+		constexpr auto size()
+		requires SizedRange<Rng> && detail::StaticallySized<InnerRng>
+		{ return size_(*this); }
+
+		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+		template<class ConstRng = const Rng>
+		constexpr auto size() const
+		requires SizedRange<ConstRng> &&
+			std::is_reference_v<iter_reference_t<iterator_t<ConstRng>>> &&
+			detail::StaticallySized<iter_reference_t<iterator_t<ConstRng>>>
+		{ return size_(*this); }
+
+		// Extension: internal iteration
+		template<class Sink>
+		friend constexpr bool for_each_while(join_view& self, Sink& sink)
+		{ return for_each_while_impl(self, sink); }
+
+		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+		template<class Sink, class ConstRng = const Rng>
+		requires InputRange<ConstRng> &&
+			std::is_reference_v<iter_reference_t<iterator_t<ConstRng>>>
+		friend constexpr bool for_each_while(const join_view& self, Sink& sink)
+		{ return for_each_while_impl(self, sink); }
+	private:
+		template<class Self>
+		static constexpr auto size_(Self& self) {
+			using Base = __maybe_const<std::is_const_v<Self>, Rng>;
+			const auto n = __stl2::size(self.base_);
+			return n * static_cast<decltype(n)>(
+				detail::static_size<__uncvref<iter_reference_t<iterator_t<Base>>>>);
+		}
+
+		template<class Self, class Sink>
+		static constexpr bool for_each_while_impl(Self& self, Sink& sink) {
+			return __stl2::ext::for_each_while(self.base_, [&](auto&& inner) -> bool {
+				return __stl2::ext::for_each_while(inner, sink);
+			});
+		}
 	};
 
 	template<InputRange Rng>
@@ -183,6 +242,11 @@ STL2_OPEN_NAMESPACE {
 		: outer_(outer), parent_(&parent)
 		{ satisfy_(); }
 
+		constexpr __iterator(Parent& parent, iterator_t<Base> outer,
+			iterator_t<iter_reference_t<iterator_t<Base>>> inner)
+		: outer_(std::move(outer)), inner_(std::move(inner)), parent_(&parent)
+		{}
+
 		constexpr __iterator(__iterator<!Const> i) requires Const &&
 			ConvertibleTo<iterator_t<Rng>, iterator_t<Base>> &&
 			ConvertibleTo<
@@ -251,6 +315,25 @@ STL2_OPEN_NAMESPACE {
 			EqualityComparable<iterator_t<iter_reference_t<iterator_t<Base>>>>
 		{ return !(x == y); }
 
+		// Extension: ext::segmented_iterator_traits, when the inner ranges
+		// are lvalues. The segments are the outer range's elements.
+		constexpr iterator_t<Base> outer() const
+		requires std::is_reference_v<iter_reference_t<iterator_t<Base>>>
+		{ return outer_; }
+
+		constexpr iterator_t<iter_reference_t<iterator_t<Base>>> inner() const
+		requires std::is_reference_v<iter_reference_t<iterator_t<Base>>>
+		{ return inner_; }
+
+		constexpr sentinel_t<Base> outer_end() const
+		requires std::is_reference_v<iter_reference_t<iterator_t<Base>>>
+		{ return __stl2::end(parent_->base_); }
+
+		constexpr __iterator compose(iterator_t<Base> outer,
+			iterator_t<iter_reference_t<iterator_t<Base>>> inner) const
+		requires std::is_reference_v<iter_reference_t<iterator_t<Base>>>
+		{ return {*parent_, std::move(outer), std::move(inner)}; }
+
 		friend constexpr decltype(auto) iter_move(const __iterator& i)
 			noexcept(noexcept(__stl2::iter_move(i.inner_)))
 		{ return __stl2::iter_move(i.inner_); }
@@ -278,6 +361,11 @@ STL2_OPEN_NAMESPACE {
 			ConvertibleTo<sentinel_t<Rng>, sentinel_t<Base>>
 		: end_(s.end_) {}
 
+		// Extension: ext::segmented_iterator_traits
+		constexpr sentinel_t<Base> outer() const
+		requires std::is_reference_v<iter_reference_t<iterator_t<Base>>>
+		{ return end_; }
+
 		friend constexpr bool operator==(const __iterator<Const>& x, const __sentinel& y)
 		{ return x.outer_ == y.end_; }
 
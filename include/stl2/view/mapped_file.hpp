@@ -0,0 +1,167 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_MAPPED_FILE_HPP
+#define STL2_VIEW_MAPPED_FILE_HPP
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// How a mapped file will be read, passed on to madvise.
+		enum class map_advice {
+			normal, sequential, random, willneed
+		};
+
+		struct map_options {
+			map_advice advice = map_advice::normal;
+			// Ask for the mapping to be backed by huge pages where the
+			// system supports it for files; otherwise ignored.
+			bool huge_pages = false;
+		};
+
+		template<class T>
+		concept bool __mapped_byte =
+			Same<remove_cv_t<T>, char> ||
+			Same<remove_cv_t<T>, unsigned char> ||
+			Same<remove_cv_t<T>, std::byte>;
+
+		// The contents of a file, mapped into memory with mmap. A view of
+		// const bytes maps the file read-only; a view of non-const bytes
+		// maps it copy-on-write, so that writes through the view are
+		// private to the process and never reach the file. Copies share
+		// the mapping, which is unmapped along with the last of them.
+		template<class Byte = const char>
+		requires __mapped_byte<Byte>
+		class mapped_file_view
+		: public view_interface<mapped_file_view<Byte>> {
+			struct unmap {
+				std::size_t length;
+
+				void operator()(void* addr) const noexcept {
+					::munmap(addr, length);
+				}
+			};
+
+			struct file {
+				int fd;
+
+				~file() {
+					::close(fd);
+				}
+			};
+
+			[[noreturn]] static void fail(const char* what) {
+				throw std::system_error{errno, std::system_category(), what};
+			}
+
+			static int advice(map_advice a) noexcept {
+				switch (a) {
+				case map_advice::sequential:
+					return MADV_SEQUENTIAL;
+				case map_advice::random:
+					return MADV_RANDOM;
+				case map_advice::willneed:
+					return MADV_WILLNEED;
+				case map_advice::normal:
+					break;
+				}
+				return MADV_NORMAL;
+			}
+
+			std::shared_ptr<void> map_;
+			Byte* data_ = nullptr;
+			std::size_t size_ = 0;
+		public:
+			using iterator = Byte*;
+
+			mapped_file_view() = default;
+			explicit mapped_file_view(const char* path, map_options options = {}) {
+				file const f{::open(path, O_RDONLY | O_CLOEXEC)};
+				if (f.fd < 0) {
+					fail("open");
+				}
+				struct ::stat st;
+				if (::fstat(f.fd, &st) != 0) {
+					fail("fstat");
+				}
+				size_ = static_cast<std::size_t>(st.st_size);
+				if (size_ == 0) {
+					// mmap can't map nothing.
+					return;
+				}
+
+				constexpr bool cow = !std::is_const<Byte>::value;
+				int const prot = cow ? PROT_READ | PROT_WRITE : PROT_READ;
+				int const flags = cow ? MAP_PRIVATE : MAP_SHARED;
+				void* const addr = ::mmap(nullptr, size_, prot, flags, f.fd, 0);
+				if (addr == MAP_FAILED) {
+					fail("mmap");
+				}
+				map_ = std::shared_ptr<void>{addr, unmap{size_}};
+				data_ = static_cast<Byte*>(addr);
+
+				// The rest are hints; a kernel that won't take them still
+				// gives a correct mapping.
+				if (options.advice != map_advice::normal) {
+					(void)::madvise(addr, size_, advice(options.advice));
+				}
+#ifdef MADV_HUGEPAGE
+				if (options.huge_pages) {
+					(void)::madvise(addr, size_, MADV_HUGEPAGE);
+				}
+#endif
+			}
+			explicit mapped_file_view(const std::string& path, map_options options = {})
+			: mapped_file_view{path.c_str(), options}
+			{}
+
+			Byte* begin() const noexcept { return data_; }
+			Byte* end() const noexcept { return data_ + size_; }
+			Byte* data() const noexcept { return data_; }
+			std::size_t size() const noexcept { return size_; }
+			bool empty() const noexcept { return size_ == 0; }
+		};
+	}
+
+	namespace view {
+		struct __mapped_file_fn {
+			__stl2::ext::mapped_file_view<>
+			operator()(const char* path, __stl2::ext::map_options options = {}) const {
+				return __stl2::ext::mapped_file_view<>{path, options};
+			}
+			__stl2::ext::mapped_file_view<>
+			operator()(const std::string& path, __stl2::ext::map_options options = {}) const {
+				return __stl2::ext::mapped_file_view<>{path, options};
+			}
+		};
+
+		inline constexpr __mapped_file_fn mapped_file {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif // __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#endif
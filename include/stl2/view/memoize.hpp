@@ -0,0 +1,145 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_MEMOIZE_HPP
+#define STL2_VIEW_MEMOIZE_HPP
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// The elements of R, each read from R once and kept for every pass
+		// after: R is read only as far as the iterators have gone, into a
+		// buffer that all copies of the view share. So an input R can be
+		// traversed many times, and an expensive transform_view computed
+		// once per element however many passes and dereferences there
+		// are. The iterators are random-access; the view is not const-
+		// iterable, since reading it fills the buffer.
+		template<View R>
+		requires
+			InputRange<R> &&
+			Constructible<iter_value_t<iterator_t<R>>, iter_reference_t<iterator_t<R>>>
+		class memoize_view : public view_interface<memoize_view<R>> {
+			using V = iter_value_t<iterator_t<R>>;
+			using D = iter_difference_t<iterator_t<R>>;
+
+			struct state {
+				R base_;
+				std::optional<iterator_t<R>> next_;
+				// A deque grows a block at a time and never moves what it
+				// holds, so the references handed out stay good as it
+				// grows.
+				std::deque<V> elements_;
+
+				constexpr explicit state(R base)
+				: base_(std::move(base)) {}
+
+				// Reads R until the nth element is buffered; false if R
+				// ends before it.
+				bool fill(D n) {
+					if (n < static_cast<D>(elements_.size())) {
+						return true;
+					}
+					if (!next_) {
+						next_.emplace(__stl2::begin(base_));
+					}
+					auto& i = *next_;
+					auto const last = __stl2::end(base_);
+					for (; i != last; ++i) {
+						elements_.emplace_back(*i);
+						if (n < static_cast<D>(elements_.size())) {
+							++i;
+							return true;
+						}
+					}
+					return false;
+				}
+			};
+
+			struct cursor {
+				using value_type = V;
+				using difference_type = D;
+
+				state* state_ = nullptr;
+				D n_ = 0;
+
+				const V& read() const {
+					state_->fill(n_);
+					STL2_EXPECT(n_ < static_cast<D>(state_->elements_.size()));
+					return state_->elements_[static_cast<std::size_t>(n_)];
+				}
+
+				constexpr void next() noexcept { ++n_; }
+				constexpr void prev() noexcept { --n_; }
+				constexpr void advance(D n) noexcept { n_ += n; }
+
+				constexpr bool equal(const cursor& that) const noexcept
+				{ return n_ == that.n_; }
+				bool equal(default_sentinel) const
+				{ return !state_ || !state_->fill(n_); }
+
+				constexpr D distance_to(const cursor& that) const noexcept
+				{ return that.n_ - n_; }
+			};
+
+			// Null in a default-constructed view, which is empty.
+			std::shared_ptr<state> state_;
+		public:
+			memoize_view() = default;
+
+			explicit memoize_view(R base)
+			: state_(std::make_shared<state>(std::move(base))) {}
+
+			basic_iterator<cursor> begin() noexcept
+			{ return basic_iterator<cursor>{cursor{state_.get(), 0}}; }
+			default_sentinel end() const noexcept { return {}; }
+
+			// The size of R, which doesn't change as it's read.
+			constexpr auto size() const requires SizedRange<R>
+			{
+				using S = decltype(__stl2::size(state_->base_));
+				return state_ ? __stl2::size(state_->base_) : S{0};
+			}
+		};
+
+		template<Range R>
+		memoize_view(R&&) -> memoize_view<all_view<R>>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __memoize_fn : detail::__pipeable<__memoize_fn> {
+			template<InputRange Rng>
+			requires
+				ViewableRange<Rng> &&
+				Constructible<iter_value_t<iterator_t<Rng>>, iter_reference_t<iterator_t<Rng>>>
+			auto operator()(Rng&& rng) const {
+				return __stl2::ext::memoize_view{all(std::forward<Rng>(rng))};
+			}
+		};
+
+		inline constexpr __memoize_fn memoize {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -18,12 +18,21 @@
 #include <stl2/detail/iterator/move_iterator.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 
 STL2_OPEN_NAMESPACE {
 	namespace ext {
+		// Whether moving an element of R is a cast of its reference,
+		// rather than a customized iter_move that needs the iterator.
+		template<class R>
+		concept bool __moves_by_cast =
+			std::is_lvalue_reference<iter_reference_t<iterator_t<R>>>::value &&
+			Same<iter_rvalue_reference_t<iterator_t<R>>,
+				remove_reference_t<iter_reference_t<iterator_t<R>>>&&>;
+
 		template<View Rng>
 		requires InputRange<Rng>
 		class move_view : detail::ebo_box<Rng, move_view<Rng>>
@@ -70,6 +79,26 @@ STL2_OPEN_NAMESPACE {
 			bool empty()
 			requires !Range<const Rng>
 			{ return __stl2::empty(get()); }
+
+			// Extension: internal iteration
+			template<class Sink>
+			requires !Range<const Rng> && __moves_by_cast<Rng> &&
+				__for_each_while::customized<Rng>
+			friend constexpr bool for_each_while(move_view& self, Sink& sink)
+			{ return for_each_while_impl(self.get(), sink); }
+
+			template<class Sink>
+			requires Range<const Rng> && __moves_by_cast<const Rng> &&
+				__for_each_while::customized<const Rng>
+			friend constexpr bool for_each_while(const move_view& self, Sink& sink)
+			{ return for_each_while_impl(self.get(), sink); }
+		private:
+			template<class R, class Sink>
+			static constexpr bool for_each_while_impl(R& rng, Sink& sink) {
+				return __stl2::ext::for_each_while(rng, [&](auto& x) -> bool {
+					return __stl2::invoke(sink, std::move(x));
+				});
+			}
 		};
 	} // namespace ext
 
@@ -19,6 +19,7 @@
 #include <stl2/detail/memory/addressof.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/view/view_interface.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 
@@ -62,6 +63,12 @@ STL2_OPEN_NAMESPACE {
 			noexcept(noexcept(__stl2::data(*rng_)))
 			requires ContiguousRange<Rng>
 			{ return __stl2::data(*rng_); }
+
+			// Extension: internal iteration
+			template<class Sink>
+			requires __for_each_while::customized<Rng>
+			friend constexpr bool for_each_while(const ref_view& self, Sink& sink)
+			{ return __stl2::ext::for_each_while(*self.rng_, sink); }
 		};
 
 		template<class Rng>
@@ -0,0 +1,171 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_SLIDING_HPP
+#define STL2_VIEW_SLIDING_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/chunk.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		// The windows of n consecutive elements of R, the first starting
+		// at the first element and each after it one element further on;
+		// there are none when R has fewer than n elements. Like the blocks
+		// of chunk_view, the windows of a contiguous R are spans.
+		template<View R>
+		requires ForwardRange<R>
+		class sliding_view : public view_interface<sliding_view<R>> {
+			using D = iter_difference_t<iterator_t<R>>;
+
+			template<bool IsConst>
+			struct sentinel {
+				sentinel_t<__maybe_const<IsConst, R>> end_;
+			};
+
+			// A window is [first_, last_]: last_ denotes its last element,
+			// which reaches the end of R as the last window is passed.
+			template<bool IsConst>
+			struct cursor {
+				using Base = __maybe_const<IsConst, R>;
+				using difference_type = iter_difference_t<iterator_t<Base>>;
+
+				iterator_t<Base> first_{};
+				iterator_t<Base> last_{};
+
+				constexpr auto read() const
+				{ return __chunk::block(first_, __stl2::next(last_)); }
+
+				constexpr void next() {
+					++first_;
+					++last_;
+				}
+				constexpr void prev()
+				requires BidirectionalRange<Base>
+				{
+					--first_;
+					--last_;
+				}
+				constexpr void advance(difference_type n)
+				requires RandomAccessRange<Base>
+				{
+					first_ += n;
+					last_ += n;
+				}
+
+				constexpr bool equal(const cursor& that) const
+				{ return last_ == that.last_; }
+				constexpr bool equal(const sentinel<IsConst>& s) const
+				{ return last_ == s.end_; }
+
+				constexpr difference_type distance_to(const cursor& that) const
+				requires SizedSentinel<iterator_t<Base>, iterator_t<Base>>
+				{ return that.last_ - last_; }
+				constexpr difference_type distance_to(const sentinel<IsConst>& s) const
+				requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+				{ return s.end_ - last_; }
+			};
+
+			R base_;
+			D size_ = 1;
+
+			// O(1) over a random-access R, else O(n).
+			template<bool IsConst, class Base>
+			constexpr auto begin_impl(Base& r) const {
+				auto first = __stl2::begin(r);
+				auto last = __stl2::next(first, size_ - 1, __stl2::end(r));
+				return basic_iterator<cursor<IsConst>>{cursor<IsConst>{std::move(first), std::move(last)}};
+			}
+			template<bool IsConst, class Base>
+			constexpr auto end_impl(Base& r) const {
+				if constexpr (CommonRange<Base> && BidirectionalRange<Base>) {
+					// The last window passed is the one that ends at the end,
+					// or, when there are no windows, the empty one at begin.
+					auto last = __stl2::end(r);
+					auto first = last;
+					if (size_ > 1) {
+						first = __stl2::prev(last, size_ - 1, __stl2::begin(r));
+					}
+					return basic_iterator<cursor<IsConst>>{cursor<IsConst>{std::move(first), std::move(last)}};
+				} else {
+					return sentinel<IsConst>{__stl2::end(r)};
+				}
+			}
+			template<class Base>
+			constexpr auto size_impl(Base& r) const {
+				auto const size = __stl2::size(r);
+				using S = decltype(size);
+				auto const n = static_cast<S>(size_);
+				return size < n ? S{0} : static_cast<S>(size - n + 1);
+			}
+		public:
+			sliding_view() = default;
+
+			constexpr sliding_view(R base, D size)
+			: base_(std::move(base)), size_(size)
+			{ STL2_EXPECT(0 < size); }
+
+			template<ViewableRange O>
+			requires _ConstructibleFromRange<R, O>
+			constexpr sliding_view(O&& o, D size)
+			: base_(view::all(std::forward<O>(o))), size_(size)
+			{ STL2_EXPECT(0 < size); }
+
+			constexpr R base() const { return base_; }
+			constexpr D window_size() const noexcept { return size_; }
+
+			constexpr auto begin() requires !Range<const R>
+			{ return begin_impl<false>(base_); }
+			constexpr auto begin() const requires Range<const R>
+			{ return begin_impl<true>(base_); }
+
+			constexpr auto end() requires !Range<const R>
+			{ return end_impl<false>(base_); }
+			constexpr auto end() const requires Range<const R>
+			{ return end_impl<true>(base_); }
+
+			constexpr auto size() requires !Range<const R> && SizedRange<R>
+			{ return size_impl(base_); }
+			constexpr auto size() const requires SizedRange<const R>
+			{ return size_impl(base_); }
+		};
+
+		template<Range R>
+		sliding_view(R&&, iter_difference_t<iterator_t<R>>) -> sliding_view<all_view<R>>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __sliding_fn {
+			template<Range Rng>
+			constexpr auto operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> size) const
+			STL2_NOEXCEPT_REQUIRES_RETURN(
+				__stl2::ext::sliding_view{all(std::forward<Rng>(rng)), size}
+			)
+
+			template<Integral D>
+			constexpr auto operator()(D size) const
+			{ return detail::view_closure{*this, static_cast<D>(size)}; }
+		};
+
+		inline constexpr __sliding_fn sliding {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -13,7 +13,10 @@
 #define STL2_VIEW_SPLIT_HPP
 
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/detail/algorithm/find.hpp>
 #include <stl2/detail/algorithm/mismatch.hpp>
+#include <stl2/detail/algorithm/search.hpp>
 #include <stl2/detail/concepts/algorithm.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/range/access.hpp>
@@ -164,6 +167,11 @@ STL2_OPEN_NAMESPACE {
 			if (cur == end) return *this;
 			const auto [pbegin, pend] = subrange{parent_->pattern_};
 			if (pbegin == pend) ++cur;
+			else if (__stl2::next(pbegin) == pend) {
+				// A single delimiter: find it with find's fast paths.
+				cur = __stl2::find(std::move(cur), end, *pbegin);
+				if (cur != end) ++cur;
+			}
 			else {
 				do {
 					const auto [b, p] = __stl2::mismatch(cur, end, pbegin, pend);
@@ -264,6 +272,34 @@ STL2_OPEN_NAMESPACE {
 				++*this;
 		}
 
+		// Extension: over a contiguous base, an ext::SegmentedIterator
+		// whose one segment is the rest of the current piece.
+		constexpr ext::span<const value_type> segment() const
+		requires ContiguousRange<Base>
+		{
+			if (*this == default_sentinel{}) return {};
+			const auto& cur = i_.current();
+			const auto [pbegin, pend] = subrange{i_.parent_->pattern_};
+			const auto end = __stl2::end(i_.parent_->base_);
+			// The pattern doesn't match at cur, so the piece goes on past it.
+			auto last = __stl2::next(cur);
+			if (pbegin != pend && last != end) {
+				last = __stl2::next(pbegin) == pend ?
+					__stl2::find(last, end, *pbegin) :
+					__stl2::search(last, end, pbegin, pend).begin();
+			}
+			return {ext::to_address(cur), last - cur};
+		}
+
+		constexpr void consume(difference_type n)
+		requires ContiguousRange<Base>
+		{
+			if (n > 0) {
+				i_.current() += n;
+				zero_ = true;
+			}
+		}
+
 		friend constexpr bool operator==(const __inner_iterator& x, const __inner_iterator& y)
 		requires ForwardRange<Base>
 		{ return x.i_ == y.i_; }
@@ -0,0 +1,173 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_STRIDE_HPP
+#define STL2_VIEW_STRIDE_HPP
+
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		namespace __stride {
+			// Where an iterator that steps n elements at a time through
+			// Base is: at current_, and missing_ elements short of a whole
+			// step if the last one ran into the end. prev and advance take
+			// missing_ into account to step back onto the same elements.
+			template<Range Base>
+			struct position {
+				using difference_type = iter_difference_t<iterator_t<Base>>;
+
+				iterator_t<Base> current_{};
+				sentinel_t<Base> end_{};
+				difference_type stride_ = 0;
+				difference_type missing_ = 0;
+
+				constexpr void next() {
+					missing_ = __stl2::advance(current_, stride_, end_);
+				}
+				constexpr void prev()
+				requires BidirectionalRange<Base>
+				{
+					__stl2::advance(current_, missing_ - stride_);
+					missing_ = 0;
+				}
+				constexpr void advance(difference_type n)
+				requires RandomAccessRange<Base>
+				{
+					if (n > 0) {
+						__stl2::advance(current_, stride_ * (n - 1));
+						next();
+					} else if (n < 0) {
+						__stl2::advance(current_, stride_ * n + missing_);
+						missing_ = 0;
+					}
+				}
+
+				constexpr bool equal(const position& that) const
+				requires ForwardRange<Base>
+				{ return current_ == that.current_; }
+				constexpr bool equal(default_sentinel) const
+				{ return current_ == end_; }
+
+				constexpr difference_type distance_to(const position& that) const
+				requires SizedSentinel<iterator_t<Base>, iterator_t<Base>>
+				{ return (that.current_ - current_ + that.missing_ - missing_) / stride_; }
+				constexpr difference_type distance_to(default_sentinel) const
+				requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+				{ return (end_ - current_ + stride_ - 1) / stride_; }
+			};
+
+			// The past-the-end position of a stride over r, when it can
+			// be an iterator; otherwise default_sentinel.
+			template<class Cursor, Range Base>
+			constexpr auto end(Base& r, iter_difference_t<iterator_t<Base>> stride) {
+				if constexpr (ForwardRange<Base> && CommonRange<Base> && SizedRange<Base>) {
+					auto const size = static_cast<iter_difference_t<iterator_t<Base>>>(
+						__stl2::size(r));
+					auto const missing = (stride - size % stride) % stride;
+					return basic_iterator<Cursor>{Cursor{{__stl2::end(r), __stl2::end(r), stride, missing}}};
+				} else if constexpr (ForwardRange<Base> && CommonRange<Base> &&
+					!BidirectionalRange<Base>)
+				{
+					// No step back from the end, so no need to know how far
+					// short of it the last step fell.
+					return basic_iterator<Cursor>{Cursor{{__stl2::end(r), __stl2::end(r), stride, 0}}};
+				} else {
+					return default_sentinel{};
+				}
+			}
+
+			template<Range Base>
+			constexpr auto size(Base& r, iter_difference_t<iterator_t<Base>> stride) {
+				auto const size = __stl2::size(r);
+				using S = decltype(size);
+				return (size + static_cast<S>(stride) - 1) / static_cast<S>(stride);
+			}
+		}
+
+		// Every stride-th element of R, starting with the first.
+		template<View R>
+		requires InputRange<R>
+		class stride_view : public view_interface<stride_view<R>> {
+			using D = iter_difference_t<iterator_t<R>>;
+
+			template<bool IsConst>
+			struct cursor : __stride::position<__maybe_const<IsConst, R>> {
+				constexpr decltype(auto) read() const
+				{ return *this->current_; }
+			};
+
+			R base_;
+			D stride_ = 1;
+		public:
+			stride_view() = default;
+
+			constexpr stride_view(R base, D stride)
+			: base_(std::move(base)), stride_(stride)
+			{ STL2_EXPECT(0 < stride); }
+
+			template<ViewableRange O>
+			requires _ConstructibleFromRange<R, O>
+			constexpr stride_view(O&& o, D stride)
+			: base_(view::all(std::forward<O>(o))), stride_(stride)
+			{ STL2_EXPECT(0 < stride); }
+
+			constexpr R base() const { return base_; }
+			constexpr D stride() const noexcept { return stride_; }
+
+			constexpr auto begin() requires !Range<const R>
+			{ return basic_iterator<cursor<false>>{cursor<false>{{__stl2::begin(base_), __stl2::end(base_), stride_, 0}}}; }
+			constexpr auto begin() const requires Range<const R>
+			{ return basic_iterator<cursor<true>>{cursor<true>{{__stl2::begin(base_), __stl2::end(base_), stride_, 0}}}; }
+
+			constexpr auto end() requires !Range<const R>
+			{ return __stride::end<cursor<false>>(base_, stride_); }
+			constexpr auto end() const requires Range<const R>
+			{ return __stride::end<cursor<true>>(base_, stride_); }
+
+			constexpr auto size() requires !Range<const R> && SizedRange<R>
+			{ return __stride::size(base_, stride_); }
+			constexpr auto size() const requires SizedRange<const R>
+			{ return __stride::size(base_, stride_); }
+		};
+
+		template<Range R>
+		stride_view(R&&, iter_difference_t<iterator_t<R>>) -> stride_view<all_view<R>>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __stride_fn {
+			template<Range Rng>
+			constexpr auto operator()(Rng&& rng, iter_difference_t<iterator_t<Rng>> stride) const
+			STL2_NOEXCEPT_REQUIRES_RETURN(
+				__stl2::ext::stride_view{all(std::forward<Rng>(rng)), stride}
+			)
+
+			template<Integral D>
+			constexpr auto operator()(D stride) const
+			{ return detail::view_closure{*this, static_cast<D>(stride)}; }
+		};
+
+		inline constexpr __stride_fn stride {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -18,6 +18,7 @@
 #include <stl2/detail/iterator/counted_iterator.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -51,7 +52,8 @@ STL2_OPEN_NAMESPACE {
 			using RR = __maybe_const<is_const, R>;
 			if constexpr (RandomAccessRange<RR> && SizedRange<RR>) {
 				return __stl2::begin(self.base_) + self.size();
-			} else if constexpr (SizedRange<RR>) {
+			} else if constexpr (SizedRange<RR> || _UnboundedRange<RR>) {
+				// The count runs out first.
 				return default_sentinel{};
 			} else {
 				return __sentinel<is_const>{__stl2::end(self.base_)};
@@ -59,9 +61,14 @@ STL2_OPEN_NAMESPACE {
 		}
 		template<class Self>
 		static constexpr auto size_(Self& self) {
-			const auto n = __stl2::size(self.base_);
-			const auto c = static_cast<decltype(n)>(self.count_);
-			return n < c ? n : c;
+			using RR = __maybe_const<std::is_const_v<Self>, R>;
+			if constexpr (SizedRange<RR>) {
+				const auto n = __stl2::size(self.base_);
+				const auto c = static_cast<decltype(n)>(self.count_);
+				return n < c ? n : c;
+			} else {
+				return self.count_;
+			}
 		}
 	public:
 		take_view() = default;
@@ -83,8 +90,35 @@ STL2_OPEN_NAMESPACE {
 		constexpr auto end() const requires Range<const R> || SizedRange<R>
 		{ return end_(*this); }
 
-		constexpr auto size() requires !ext::SimpleView<R> && SizedRange<R> { return size_(*this); }
-		constexpr auto size() const requires SizedRange<const R> { return size_(*this); }
+		constexpr auto size() requires !ext::SimpleView<R> && (SizedRange<R> || _UnboundedRange<R>)
+		{ return size_(*this); }
+		constexpr auto size() const requires SizedRange<const R> || _UnboundedRange<const R>
+		{ return size_(*this); }
+
+		// Extension: internal iteration
+		template<class Sink>
+		requires __for_each_while::customized<R>
+		friend constexpr bool for_each_while(take_view& self, Sink& sink)
+		{ return for_each_while_(self, sink); }
+
+		template<class Sink>
+		requires Range<const R> && __for_each_while::customized<const R>
+		friend constexpr bool for_each_while(const take_view& self, Sink& sink)
+		{ return for_each_while_(self, sink); }
+	private:
+		template<class Self, class Sink>
+		static constexpr bool for_each_while_(Self& self, Sink& sink) {
+			auto n = self.count_;
+			if (n <= 0) {
+				return true;
+			}
+			bool stopped = false;
+			__stl2::ext::for_each_while(self.base_, [&](auto&& x) -> bool {
+				stopped = !__stl2::invoke(sink, std::forward<decltype(x)>(x));
+				return !stopped && --n != 0;
+			});
+			return !stopped;
+		}
 	};
 
 	template<Range R>
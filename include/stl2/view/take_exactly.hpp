@@ -21,6 +21,7 @@
 #include <stl2/detail/iterator/default_sentinel.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -93,6 +94,31 @@ STL2_OPEN_NAMESPACE {
 			constexpr default_sentinel end() const noexcept { return {}; }
 			constexpr iter_difference_t<iterator_t<Base>> size() const noexcept { return n_; }
 			constexpr bool empty() const noexcept { return n_ == 0; }
+
+			// Extension: internal iteration
+			template<class Sink>
+			requires !Range<Base const> && __for_each_while::customized<Base>
+			friend constexpr bool for_each_while(take_exactly_view& self, Sink& sink)
+			{ return for_each_while_impl(self.get(), self.n_, sink); }
+
+			template<class Sink>
+			requires Range<Base const> && __for_each_while::customized<Base const>
+			friend constexpr bool for_each_while(const take_exactly_view& self, Sink& sink)
+			{ return for_each_while_impl(self.get(), self.n_, sink); }
+		private:
+			template<class B, class Sink>
+			static constexpr bool
+			for_each_while_impl(B& base, iter_difference_t<iterator_t<Base>> n, Sink& sink) {
+				if (n == 0) {
+					return true;
+				}
+				bool stopped = false;
+				__stl2::ext::for_each_while(base, [&](auto&& x) -> bool {
+					stopped = !__stl2::invoke(sink, std::forward<decltype(x)>(x));
+					return !stopped && --n != 0;
+				});
+				return !stopped;
+			}
 		};
 
 		template<Range R>
@@ -21,6 +21,7 @@
 #include <stl2/detail/semiregular_box.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -56,6 +57,16 @@ STL2_OPEN_NAMESPACE {
 			constexpr auto end() requires !SimpleView<R> { return end_impl(*this); }
 			constexpr auto end() const requires Range<const R>
 			{ return end_impl(*this); }
+
+			// Extension: internal iteration
+			template<class Sink>
+			friend constexpr bool for_each_while(take_while_view& self, Sink& sink)
+			{ return for_each_while_impl(self, sink); }
+
+			template<class Sink>
+			requires Range<const R>
+			friend constexpr bool for_each_while(const take_while_view& self, Sink& sink)
+			{ return for_each_while_impl(self, sink); }
 		private:
 			R base_;
 
@@ -67,6 +78,20 @@ STL2_OPEN_NAMESPACE {
 				constexpr bool is_const = std::is_const_v<Self>;
 				return __sentinel<is_const>{__stl2::end(self.base_), &self.pred()};
 			}
+
+			template<class Self, class Sink>
+			static constexpr bool for_each_while_impl(Self& self, Sink& sink) {
+				auto& pred = self.pred();
+				bool stopped = false;
+				__stl2::ext::for_each_while(self.base_, [&](auto&& x) -> bool {
+					if (!__stl2::invoke(pred, x)) {
+						return false;
+					}
+					stopped = !__stl2::invoke(sink, std::forward<decltype(x)>(x));
+					return !stopped;
+				});
+				return !stopped;
+			}
 		};
 
 		template<class R, class Pred>
@@ -20,6 +20,7 @@
 #include <stl2/detail/functional/invoke.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/for_each_while.hpp>
 #include <stl2/detail/view/view_closure.hpp>
 #include <stl2/view/all.hpp>
 #include <stl2/view/view_interface.hpp>
@@ -86,6 +87,27 @@ STL2_OPEN_NAMESPACE {
 
 		constexpr auto size() const requires SizedRange<const R>
 		{ return __stl2::size(base_); }
+
+		// Extension: internal iteration
+		template<class Sink>
+		friend constexpr bool for_each_while(transform_view& self, Sink& sink)
+		{ return for_each_while_impl(self, sink); }
+
+		// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+		template<class Sink, class ConstR = const R>
+		requires Range<ConstR> &&
+			Invocable<const F&, iter_reference_t<iterator_t<ConstR>>>
+		friend constexpr bool for_each_while(const transform_view& self, Sink& sink)
+		{ return for_each_while_impl(self, sink); }
+	private:
+		template<class Self, class Sink>
+		static constexpr bool for_each_while_impl(Self& self, Sink& sink) {
+			auto& fun = self.fun_.get();
+			return __stl2::ext::for_each_while(self.base_, [&](auto&& x) -> bool {
+				return __stl2::invoke(sink,
+					__stl2::invoke(fun, std::forward<decltype(x)>(x)));
+			});
+		}
 	};
 
 	template<class R, class F>
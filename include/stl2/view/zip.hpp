@@ -0,0 +1,309 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_ZIP_HPP
+#define STL2_VIEW_ZIP_HPP
+
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/common_tuple.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/semiregular_box.hpp>
+#include <stl2/detail/functional/invoke.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		namespace __zip {
+			template<class... Bases>
+			struct sentinel {
+				std::tuple<sentinel_t<Bases>...> ends_;
+			};
+
+			// Which of Bases to compare positions by: the first that ends,
+			// if any do. An iterator into a range that never ends needn't
+			// tell positions apart; repeat_view's all compare equal.
+			template<class... Bases>
+			constexpr std::size_t key() noexcept {
+				bool const unbounded[] = {_UnboundedRange<Bases>...};
+				for (std::size_t i = 0; i < sizeof...(Bases); ++i) {
+					if (!unbounded[i]) return i;
+				}
+				return 0;
+			}
+
+			// The iterators into each of Bases, which move in lockstep.
+			template<class... Bases>
+			struct position {
+				using difference_type = common_type_t<iter_difference_t<iterator_t<Bases>>...>;
+
+				std::tuple<iterator_t<Bases>...> its_;
+
+				constexpr void next() {
+					std::apply([](auto&... i) { (++i, ...); }, its_);
+				}
+				constexpr void prev()
+				requires (BidirectionalRange<Bases> && ...)
+				{
+					std::apply([](auto&... i) { (--i, ...); }, its_);
+				}
+				constexpr void advance(difference_type n)
+				requires (RandomAccessRange<Bases> && ...)
+				{
+					std::apply([n](auto&... i) {
+						((i += static_cast<iter_difference_t<__uncvref<decltype(i)>>>(n)), ...);
+					}, its_);
+				}
+
+				// Being in lockstep, two positions are equal when any one of
+				// their iterators are.
+				constexpr bool equal(const position& that) const
+				requires (ForwardRange<Bases> && ...)
+				{ return std::get<K>(its_) == std::get<K>(that.its_); }
+				// The end is the end of the shortest.
+				constexpr bool equal(const sentinel<Bases...>& s) const
+				{ return equal(s, std::index_sequence_for<Bases...>{}); }
+
+				constexpr difference_type distance_to(const position& that) const
+				requires (SizedSentinel<iterator_t<Bases>, iterator_t<Bases>> && ...)
+				{ return static_cast<difference_type>(std::get<K>(that.its_) - std::get<K>(its_)); }
+				constexpr difference_type distance_to(const sentinel<Bases...>& s) const
+				requires (SizedSentinel<sentinel_t<Bases>, iterator_t<Bases>> && ...)
+				{ return distance_to(s, std::index_sequence_for<Bases...>{}); }
+			private:
+				static constexpr std::size_t K = key<Bases...>();
+
+				template<std::size_t... Is>
+				constexpr bool equal(const sentinel<Bases...>& s, std::index_sequence<Is...>) const
+				{ return ((std::get<Is>(its_) == std::get<Is>(s.ends_)) || ...); }
+
+				template<std::size_t... Is>
+				constexpr difference_type distance_to(const sentinel<Bases...>& s, std::index_sequence<Is...>) const {
+					difference_type const ds[] = {
+						static_cast<difference_type>(std::get<Is>(s.ends_) - std::get<Is>(its_))...
+					};
+					auto d = ds[0];
+					for (auto x : ds) {
+						if (x < d) d = x;
+					}
+					return d;
+				}
+			};
+
+			// What the size of R is counted in: the difference type, for
+			// an R that never ends.
+			template<class R>
+			struct size_type {
+				using type = iter_difference_t<iterator_t<R>>;
+			};
+			template<SizedRange R>
+			struct size_type<R> {
+				using type = decltype(__stl2::size(std::declval<R&>()));
+			};
+
+			// The length of the shortest is known when each of Rs is either
+			// sized or never ends, and one of them is sized.
+			template<class... Rs>
+			concept bool Sized =
+				((SizedRange<Rs> || _UnboundedRange<Rs>) && ...) &&
+				(SizedRange<Rs> || ...);
+
+			// The size of the shortest of rs.
+			template<class... Rs>
+			requires Sized<Rs...>
+			constexpr auto size(Rs&... rs) {
+				using S = common_type_t<meta::_t<size_type<Rs>>...>;
+				auto n = std::numeric_limits<S>::max();
+				([&n](auto& r) {
+					if constexpr (SizedRange<decltype(r)>) {
+						auto const s = static_cast<S>(__stl2::size(r));
+						if (s < n) n = s;
+					}
+				}(rs), ...);
+				return n;
+			}
+
+			template<class Cursor, class... Bases>
+			constexpr auto begin(Cursor c, Bases&... bases) {
+				c.its_ = std::tuple<iterator_t<Bases>...>{__stl2::begin(bases)...};
+				return basic_iterator<Cursor>{std::move(c)};
+			}
+
+			// The past-the-end position: an iterator when all of bases are
+			// random-access and the end of the shortest is known; otherwise
+			// a sentinel.
+			template<class Cursor, class... Bases>
+			constexpr auto end(Cursor c, Bases&... bases) {
+				if constexpr ((RandomAccessRange<Bases> && ...) && Sized<Bases...>) {
+					auto const n = __zip::size(bases...);
+					c.its_ = std::tuple<iterator_t<Bases>...>{
+						__stl2::begin(bases) + static_cast<iter_difference_t<iterator_t<Bases>>>(n)...
+					};
+					return basic_iterator<Cursor>{std::move(c)};
+				} else {
+					return sentinel<Bases...>{std::tuple<sentinel_t<Bases>...>{__stl2::end(bases)...}};
+				}
+			}
+
+			template<class... Rs>
+			concept bool ConstIterable = (Range<const Rs> && ...);
+
+			template<class F, class... Rs>
+			concept bool ConstInvocable =
+				ConstIterable<Rs...> &&
+				Invocable<const F&, iter_reference_t<iterator_t<const Rs>>...>;
+		}
+
+		// The tuples of the corresponding elements of Rs, up to the end of
+		// the shortest. Its reference is a common_tuple of the references
+		// of Rs, which assigns through them and swaps and moves each of
+		// them with their own iter_swap and iter_move; so zip_view is
+		// Permutable and Sortable when each of Rs is, and sorting it by a
+		// projection of one column permutes all the columns along with it.
+		template<View... Rs>
+		requires sizeof...(Rs) > 0 && (InputRange<Rs> && ...)
+		class zip_view : public view_interface<zip_view<Rs...>> {
+			template<bool IsConst>
+			struct cursor : __zip::position<__maybe_const<IsConst, Rs>...> {
+				using value_type = common_tuple<iter_value_t<iterator_t<__maybe_const<IsConst, Rs>>>...>;
+
+				constexpr auto read() const {
+					return std::apply([](const auto&... i) {
+						return common_tuple<decltype(*i)...>{*i...};
+					}, this->its_);
+				}
+				constexpr auto indirect_move() const {
+					return std::apply([](const auto&... i) {
+						return common_tuple<decltype(__stl2::iter_move(i))...>{__stl2::iter_move(i)...};
+					}, this->its_);
+				}
+				constexpr void indirect_swap(const cursor& that) const
+				requires (IndirectlySwappable<iterator_t<__maybe_const<IsConst, Rs>>> && ...)
+				{ swap(that, std::index_sequence_for<Rs...>{}); }
+			private:
+				template<std::size_t... Is>
+				constexpr void swap(const cursor& that, std::index_sequence<Is...>) const {
+					(__stl2::iter_swap(std::get<Is>(this->its_), std::get<Is>(that.its_)), ...);
+				}
+			};
+
+			std::tuple<Rs...> bases_;
+		public:
+			zip_view() = default;
+			constexpr explicit zip_view(Rs... rs)
+			: bases_(std::move(rs)...) {}
+
+			constexpr auto begin() requires !__zip::ConstIterable<Rs...>
+			{ return std::apply([](auto&... r) { return __zip::begin(cursor<false>{}, r...); }, bases_); }
+			constexpr auto begin() const requires __zip::ConstIterable<Rs...>
+			{ return std::apply([](auto&... r) { return __zip::begin(cursor<true>{}, r...); }, bases_); }
+
+			constexpr auto end() requires !__zip::ConstIterable<Rs...>
+			{ return std::apply([](auto&... r) { return __zip::end(cursor<false>{}, r...); }, bases_); }
+			constexpr auto end() const requires __zip::ConstIterable<Rs...>
+			{ return std::apply([](auto&... r) { return __zip::end(cursor<true>{}, r...); }, bases_); }
+
+			constexpr auto size() requires !__zip::ConstIterable<Rs...> && __zip::Sized<Rs...>
+			{ return std::apply([](auto&... r) { return __zip::size(r...); }, bases_); }
+			constexpr auto size() const requires __zip::Sized<const Rs...>
+			{ return std::apply([](auto&... r) { return __zip::size(r...); }, bases_); }
+		};
+
+		template<class... Rs>
+		zip_view(Rs&&...) -> zip_view<all_view<Rs>...>;
+
+		// F applied to the corresponding elements of Rs, up to the end of
+		// the shortest; a transform_view of several ranges.
+		template<CopyConstructible F, View... Rs>
+		requires
+			sizeof...(Rs) > 0 && (InputRange<Rs> && ...) &&
+			Invocable<F&, iter_reference_t<iterator_t<Rs>>...>
+		class zip_with_view : public view_interface<zip_with_view<F, Rs...>> {
+			template<bool IsConst>
+			struct cursor : __zip::position<__maybe_const<IsConst, Rs>...> {
+				__maybe_const<IsConst, zip_with_view>* parent_ = nullptr;
+
+				constexpr decltype(auto) read() const {
+					return std::apply([this](const auto&... i) -> decltype(auto) {
+						return __stl2::invoke(parent_->fun_.get(), *i...);
+					}, this->its_);
+				}
+			};
+
+			detail::semiregular_box<F> fun_;
+			std::tuple<Rs...> bases_;
+
+			template<bool IsConst, class Self>
+			static constexpr cursor<IsConst> make_cursor(Self& self) {
+				cursor<IsConst> c{};
+				c.parent_ = &self;
+				return c;
+			}
+		public:
+			zip_with_view() = default;
+			constexpr explicit zip_with_view(F fun, Rs... rs)
+			: fun_(std::move(fun)), bases_(std::move(rs)...) {}
+
+			constexpr auto begin() requires !__zip::ConstInvocable<F, Rs...>
+			{ return std::apply([this](auto&... r) { return __zip::begin(make_cursor<false>(*this), r...); }, bases_); }
+			constexpr auto begin() const requires __zip::ConstInvocable<F, Rs...>
+			{ return std::apply([this](auto&... r) { return __zip::begin(make_cursor<true>(*this), r...); }, bases_); }
+
+			constexpr auto end() requires !__zip::ConstInvocable<F, Rs...>
+			{ return std::apply([this](auto&... r) { return __zip::end(make_cursor<false>(*this), r...); }, bases_); }
+			constexpr auto end() const requires __zip::ConstInvocable<F, Rs...>
+			{ return std::apply([this](auto&... r) { return __zip::end(make_cursor<true>(*this), r...); }, bases_); }
+
+			constexpr auto size() requires !__zip::ConstInvocable<F, Rs...> && __zip::Sized<Rs...>
+			{ return std::apply([](auto&... r) { return __zip::size(r...); }, bases_); }
+			constexpr auto size() const requires __zip::Sized<const Rs...>
+			{ return std::apply([](auto&... r) { return __zip::size(r...); }, bases_); }
+		};
+
+		template<class F, class... Rs>
+		zip_with_view(F, Rs&&...) -> zip_with_view<F, all_view<Rs>...>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __zip_fn {
+			template<InputRange... Rngs>
+			requires sizeof...(Rngs) > 0 && (ViewableRange<Rngs> && ...)
+			constexpr auto operator()(Rngs&&... rngs) const {
+				return __stl2::ext::zip_view{all(std::forward<Rngs>(rngs))...};
+			}
+		};
+
+		inline constexpr __zip_fn zip {};
+
+		struct __zip_with_fn {
+			template<CopyConstructible F, InputRange... Rngs>
+			requires
+				sizeof...(Rngs) > 0 && (ViewableRange<Rngs> && ...) &&
+				Invocable<F&, iter_reference_t<iterator_t<Rngs>>...>
+			constexpr auto operator()(F fun, Rngs&&... rngs) const {
+				return __stl2::ext::zip_with_view{std::move(fun), all(std::forward<Rngs>(rngs))...};
+			}
+		};
+
+		inline constexpr __zip_with_fn zip_with {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
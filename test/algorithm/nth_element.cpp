@@ -23,6 +23,7 @@
 #include <memory>
 #include <random>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -66,6 +67,23 @@ test(unsigned N)
 	test_one(N, N-1);
 }
 
+void
+test_duplicates(unsigned N, unsigned M)
+{
+	std::vector<int> v(N);
+	for (unsigned i = 0; i < N; ++i)
+		v[i] = i % 7;
+	std::shuffle(v.begin(), v.end(), gen);
+	std::vector<int> sorted = v;
+	std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+	CHECK(stl2::nth_element(v, v.begin() + M, stl2::greater<>{}) == v.end());
+	CHECK(v[M] == sorted[M]);
+	for (unsigned i = 0; i < M; ++i)
+		CHECK(v[i] >= v[M]);
+	for (unsigned i = M + 1; i < N; ++i)
+		CHECK(v[i] <= v[M]);
+}
+
 struct S
 {
 	int i,j;
@@ -84,6 +102,11 @@ int main()
 	test(1000);
 	test(1009);
 
+	test_duplicates(1000, 0);
+	test_duplicates(1000, 500);
+	test_duplicates(1000, 999);
+	test_duplicates(10007, 5003);
+
 	// Works with projections?
 	const int N = 257;
 	const int M = 56;
@@ -0,0 +1,156 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/algorithm.hpp>
+#include <stl2/execution.hpp>
+#include <atomic>
+#include <list>
+#include <numeric>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace stl2 = __stl2;
+namespace execution = stl2::ext::execution;
+
+namespace {
+	struct S {
+		int i;
+	};
+
+	template<class E>
+	void test_policy(E&& exec, int n) {
+		std::vector<int> v(n);
+		std::iota(v.begin(), v.end(), 0);
+		auto const end = v.data() + n;
+
+		// for_each
+		{
+			std::atomic<long> sum{0};
+			auto res = stl2::for_each(exec, v, [&](int i) { sum += i; });
+			CHECK(res.in() == v.end());
+			CHECK(sum.load() == long(n) * (n - 1) / 2);
+		}
+
+		// transform, copy, fill
+		{
+			std::vector<int> out(n);
+			auto t = stl2::transform(exec, v, out.begin(), [](int i) { return 2 * i; });
+			CHECK(t.in() == v.end());
+			CHECK(t.out() == out.end());
+			for (int i = 0; i < n; ++i) {
+				CHECK(out[i] == 2 * i);
+			}
+
+			auto t2 = stl2::transform(exec, v, out, out.begin(), [](int x, int y) { return x + y; });
+			CHECK(t2.in1() == v.end());
+			CHECK(t2.in2() == out.end());
+			for (int i = 0; i < n; ++i) {
+				CHECK(out[i] == 3 * i);
+			}
+
+			auto c = stl2::copy(exec, v.data(), end, out.begin());
+			CHECK(c.in() == end);
+			CHECK(out == v);
+
+			CHECK(stl2::fill(exec, out, 42) == out.end());
+			CHECK(stl2::count(out, 42) == n);
+		}
+
+		// count_if, find_if and the quantifiers
+		{
+			auto even = [](int i) { return i % 2 == 0; };
+			CHECK(stl2::count_if(exec, v, even) == (n + 1) / 2);
+			if (n > 0) {
+				CHECK(stl2::find_if(exec, v, [n](int i) { return i >= n - 1; }) == v.end() - 1);
+				CHECK(stl2::find_if(exec, v, [](int i) { return i >= 0; }) == v.begin());
+			}
+			CHECK(stl2::find_if(exec, v, [n](int i) { return i >= n; }) == v.end());
+			CHECK(stl2::all_of(exec, v, [](int i) { return i >= 0; }));
+			CHECK(stl2::none_of(exec, v, [](int i) { return i < 0; }));
+			CHECK(!stl2::any_of(exec, v, [n](int i) { return i >= n; }));
+			if (n > 0) {
+				CHECK(stl2::any_of(exec, v, [n](int i) { return i == n / 3; }));
+				CHECK(!stl2::all_of(exec, v, [n](int i) { return i != n / 3; }));
+				CHECK(!stl2::none_of(exec, v, [n](int i) { return i == n / 3; }));
+			}
+		}
+
+		// minmax_element keeps the first minimum and the last maximum.
+		{
+			std::vector<S> s(n);
+			for (int i = 0; i < n; ++i) {
+				s[i].i = i % 1000;
+			}
+			auto m = stl2::minmax_element(exec, s, stl2::less<>{}, &S::i);
+			if (n == 0) {
+				CHECK(m.min() == s.end());
+				CHECK(m.max() == s.end());
+			} else {
+				auto e = stl2::minmax_element(s, stl2::less<>{}, &S::i);
+				CHECK(m.min() == e.min());
+				CHECK(m.max() == e.max());
+			}
+		}
+
+		// equal and mismatch
+		{
+			auto w = v;
+			CHECK(stl2::equal(exec, v, w));
+			if (n > 0) {
+				CHECK(!stl2::equal(exec, v.begin(), v.end(), w.begin(), w.end() - 1));
+			}
+			auto m = stl2::mismatch(exec, v, w);
+			CHECK(m.in1() == v.end());
+			CHECK(m.in2() == w.end());
+			if (n > 0) {
+				for (int pos : {n - 1, n / 2, 0}) {
+					w[pos] = -1;
+					CHECK(!stl2::equal(exec, v, w));
+					auto m = stl2::mismatch(exec, v, w);
+					CHECK(m.in1() == v.begin() + pos);
+					CHECK(m.in2() == w.begin() + pos);
+				}
+			}
+		}
+	}
+
+	void test_forward() {
+		// Non-random-access ranges run sequentially.
+		std::list<int> l(1000, 1);
+		CHECK(stl2::count_if(execution::par, l, [](int i) { return i == 1; }) == 1000);
+		CHECK(stl2::all_of(execution::par, l, [](int i) { return i == 1; }));
+		CHECK(stl2::fill(execution::par_unseq, l, 2) == l.end());
+		CHECK(stl2::equal(execution::par, l, std::vector<int>(1000, 2)));
+
+		int a[] = {3, 1, 4, 1, 5, 9, 2, 6};
+		using I = forward_iterator<int*>;
+		auto m = stl2::minmax_element(execution::par, I{a}, I{a + 8});
+		CHECK(m.min() == I{a + 1});
+		CHECK(m.max() == I{a + 5});
+		CHECK(stl2::find_if(execution::par, I{a}, I{a + 8}, [](int i) { return i > 4; }) == I{a + 4});
+	}
+}
+
+int main() {
+	for (int n : {0, 1, 100, 4096, 100003}) {
+		test_policy(execution::seq, n);
+		test_policy(execution::par, n);
+		test_policy(execution::par_unseq, n);
+	}
+	test_forward();
+
+	static_assert(stl2::ext::ExecutionPolicy<const execution::parallel_policy&>);
+	static_assert(!stl2::ext::ParallelPolicy<execution::sequenced_policy>);
+	static_assert(!stl2::ext::ExecutionPolicy<int>);
+
+	return ::test_result();
+}
@@ -0,0 +1,164 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/radix_sort.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace stl2 = __stl2;
+
+namespace {
+	std::mt19937_64 gen;
+
+	struct record {
+		std::int64_t key;
+		int index;
+	};
+
+	template<class T>
+	std::vector<T> random_values(int n) {
+		std::vector<T> v(n);
+		for (auto& t : v) {
+			if constexpr (std::is_floating_point<T>::value) {
+				t = std::uniform_real_distribution<T>{-1e6, 1e6}(gen);
+			} else {
+				t = static_cast<T>(gen());
+			}
+		}
+		return v;
+	}
+
+	template<class T>
+	void test_type(int n) {
+		auto v = random_values<T>(n);
+		auto expected = v;
+		std::sort(expected.begin(), expected.end());
+
+		auto a = v;
+		CHECK(stl2::ext::radix_sort(a) == a.end());
+		CHECK(a == expected);
+
+		auto b = v;
+		CHECK(stl2::ext::inplace_radix_sort(b.begin(), b.end()) == b.end());
+		CHECK(b == expected);
+
+		auto c = v;
+		using I = random_access_iterator<T*>;
+		CHECK(stl2::ext::radix_sort(I{c.data()}, sentinel<T*>{c.data() + c.size()}).base() ==
+			c.data() + c.size());
+		CHECK(c == expected);
+	}
+
+	void test_stability(int n) {
+		std::vector<record> v(n);
+		for (int i = 0; i < n; ++i) {
+			v[i] = {static_cast<std::int64_t>(gen() % 100) - 50, i};
+		}
+		auto expected = v;
+		std::stable_sort(expected.begin(), expected.end(),
+			[](const record& x, const record& y) { return x.key < y.key; });
+
+		CHECK(stl2::ext::radix_sort(v, &record::key) == v.end());
+		for (int i = 0; i < n; ++i) {
+			CHECK(v[i].key == expected[i].key);
+			CHECK(v[i].index == expected[i].index);
+		}
+
+		std::shuffle(v.begin(), v.end(), gen);
+		CHECK(stl2::ext::inplace_radix_sort(v, &record::key) == v.end());
+		CHECK(std::is_sorted(v.begin(), v.end(),
+			[](const record& x, const record& y) { return x.key < y.key; }));
+	}
+
+	void test_floating_point_order() {
+		constexpr double inf = std::numeric_limits<double>::infinity();
+		std::vector<double> v = {3.5, -0.0, inf, -1.0, 0.0, -inf, 1e-300, -1e300, 2.0};
+		std::vector<double> expected = {-inf, -1e300, -1.0, -0.0, 0.0, 1e-300, 2.0, 3.5, inf};
+		stl2::ext::radix_sort(v);
+		CHECK(v == expected);
+		CHECK(std::signbit(v[3]));
+		CHECK(!std::signbit(v[4]));
+
+		std::vector<float> f = {1.0f, -2.0f, std::nanf(""), -0.5f, 0.25f};
+		stl2::ext::inplace_radix_sort(f);
+		CHECK(f[0] == -2.0f);
+		CHECK(f[1] == -0.5f);
+		CHECK(f[2] == 0.25f);
+		CHECK(f[3] == 1.0f);
+		CHECK(std::isnan(f[4]));
+	}
+
+	void test_byte_keys(int n) {
+		using key = std::array<unsigned char, 5>;
+		std::vector<key> v(n);
+		for (auto& k : v) {
+			for (auto& b : k) {
+				b = static_cast<unsigned char>(gen() % 3);
+			}
+		}
+		auto expected = v;
+		std::sort(expected.begin(), expected.end());
+		auto a = v;
+		stl2::ext::radix_sort(a);
+		CHECK(a == expected);
+		stl2::ext::inplace_radix_sort(v);
+		CHECK(v == expected);
+	}
+
+	// Keys that differ only in their low byte, reached through a pointer
+	// that moving the element nulls: no key is read from a moved-from
+	// element.
+	void test_moved_from(int n) {
+		std::vector<std::unique_ptr<std::uint32_t>> v;
+		for (int i = 0; i < n; ++i) {
+			v.push_back(std::make_unique<std::uint32_t>(static_cast<std::uint32_t>(gen() % 256)));
+		}
+		auto const deref = [](const std::unique_ptr<std::uint32_t>& p) { return *p; };
+		stl2::ext::radix_sort(v, deref);
+		CHECK(std::is_sorted(v.begin(), v.end(), [](auto& x, auto& y) { return *x < *y; }));
+	}
+}
+
+int main() {
+	{
+		std::vector<int> empty;
+		CHECK(stl2::ext::radix_sort(empty) == empty.end());
+		CHECK(stl2::ext::inplace_radix_sort(empty) == empty.end());
+	}
+
+	for (int n : {1, 2, 31, 32, 33, 1000, 100000}) {
+		test_type<std::uint8_t>(n);
+		test_type<std::int16_t>(n);
+		test_type<std::uint32_t>(n);
+		test_type<std::int64_t>(n);
+		test_type<float>(n);
+		test_type<double>(n);
+		test_byte_keys(n);
+		test_stability(n);
+		test_moved_from(n);
+	}
+	test_floating_point_order();
+
+	static_assert(stl2::ext::RadixSortable<int*>);
+	static_assert(stl2::ext::RadixSortable<record*, std::int64_t record::*>);
+	static_assert(!stl2::ext::RadixSortable<bool*>);
+	static_assert(!stl2::ext::RadixSortable<std::vector<int>*>);
+
+	return ::test_result();
+}
@@ -25,9 +25,13 @@
 
 #include <stl2/detail/algorithm/sample.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <numeric>
+#include <vector>
 #include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -50,6 +54,28 @@ namespace {
 		MoveOnly(MoveOnly&&) = default;
 		MoveOnly& operator=(MoveOnly&&) & = default;
 	};
+
+	// Each of the 15 pairs of 6 elements should be sampled about equally
+	// often, whether the population is sized or a stream.
+	template<class F>
+	void check_pairs_uniform(F sample)
+	{
+		constexpr int trials = 30000;
+		int count[6][6] = {};
+		ranges::ext::xoshiro256starstar g{7};
+		for (int t = 0; t < trials; ++t) {
+			int data[] = {0, 1, 2, 3, 4, 5};
+			int out[2] = {-1, -1};
+			sample(data, out, g);
+			CHECK(out[0] != out[1]);
+			++count[std::min(out[0], out[1])][std::max(out[0], out[1])];
+		}
+		for (int i = 0; i < 6; ++i) {
+			for (int j = i + 1; j < 6; ++j) {
+				CHECK(std::abs(count[i][j] - trials / 15) < trials / 150);
+			}
+		}
+	}
 }
 
 int main()
@@ -276,5 +302,35 @@ int main()
 		}
 	}
 
+	check_pairs_uniform([](int (&data)[6], int (&out)[2], auto& g) {
+		ranges::sample(data, out, g);
+	});
+	check_pairs_uniform([](int (&data)[6], int (&out)[2], auto& g) {
+		ranges::sample(input_iterator<int*>(data), sentinel<int*>(data + 6), out, g);
+	});
+
+	{
+		// Neither the sized nor the streaming algorithm draws a random
+		// number per element.
+		std::vector<int> data(1000000);
+		std::iota(data.begin(), data.end(), 0);
+		int out[10];
+		counting_engine g;
+		auto result = ranges::sample(data, out, g);
+		CHECK(result.out() == ranges::end(out));
+		CHECK(ranges::is_sorted(out));
+		CHECK(g.calls < 100);
+
+		g.calls = 0;
+		auto r2 = ranges::sample(input_iterator<int*>(data.data()),
+			sentinel<int*>(data.data() + data.size()), out, g);
+		CHECK(r2.out() == ranges::end(out));
+		CHECK(g.calls < 1000);
+		for (auto i : out) {
+			CHECK(0 <= i);
+			CHECK(i < 1000000);
+		}
+	}
+
 	return ::test_result();
 }
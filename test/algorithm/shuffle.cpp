@@ -24,15 +24,110 @@
 
 #include <stl2/detail/algorithm/equal.hpp>
 #include <stl2/detail/algorithm/shuffle.hpp>
+#include <stl2/execution.hpp>
+#include <algorithm>
+#include <map>
+#include <memory>
 #include <numeric>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
 namespace stl2 = __stl2;
+namespace rnd = stl2::detail::random;
+
+// Each of the 24 permutations of 4 elements occurs about equally often.
+template<class F>
+void check_uniform(F shuffle)
+{
+	constexpr int trials = 24 * 400;
+	std::map<std::vector<int>, int> counts;
+	for (int t = 0; t < trials; ++t) {
+		std::vector<int> v = {0, 1, 2, 3};
+		shuffle(v);
+		++counts[v];
+	}
+	CHECK(counts.size() == 24u);
+	for (auto& c : counts) {
+		// 400 expected, with a standard deviation of about 20.
+		CHECK(c.second > 300);
+		CHECK(c.second < 500);
+	}
+}
+
+void test_bounded()
+{
+	std::mt19937_64 g64;
+	std::mt19937 g32;
+	for (int i = 0; i < 1000; ++i) {
+		CHECK(rnd::bounded(g64, 1) == 0u);
+		CHECK(rnd::bounded(g64, 7) < 7u);
+		CHECK(rnd::bounded(g32, 3) < 3u);
+		auto const [a, b] = rnd::bounded2(g64, 5, 9);
+		CHECK(a < 5u);
+		CHECK(b < 9u);
+		auto const [c, d] = rnd::bounded2(g32, std::uint64_t{1} << 32, std::uint64_t{1} << 32);
+		CHECK(c < std::uint64_t{1} << 32);
+		CHECK(d < std::uint64_t{1} << 32);
+	}
+	static_assert(rnd::FullWordGenerator<std::mt19937>);
+	static_assert(rnd::FullWordGenerator<std::mt19937_64>);
+	static_assert(!rnd::FullWordGenerator<std::minstd_rand>);
+}
+
+void test_parallel()
+{
+	std::mt19937_64 g;
+	check_uniform([&](std::vector<int>& v) { stl2::shuffle(v, g); });
+	check_uniform([&](std::vector<int>& v) {
+		CHECK(stl2::detail::rshuffle::scatter_shuffle(v.begin(), 4, g, 2));
+	});
+	check_uniform([&](std::vector<int>& v) {
+		CHECK(stl2::detail::rshuffle::scatter_shuffle(v.begin(), 4, g, 3));
+	});
+
+	// Large enough for two buckets.
+	constexpr int N = 1 << 17;
+	std::vector<int> v(N);
+	std::iota(v.begin(), v.end(), 0);
+	CHECK(stl2::shuffle(stl2::ext::execution::par, v) == v.end());
+	CHECK(!std::is_sorted(v.begin(), v.end()));
+	std::sort(v.begin(), v.end());
+	for (int i = 0; i < N; ++i) {
+		CHECK(v[i] == i);
+	}
+
+	std::vector<std::unique_ptr<int>> p(N);
+	for (int i = 0; i < N; ++i) {
+		p[i].reset(new int(i));
+	}
+	CHECK(stl2::shuffle(stl2::ext::execution::par_unseq, p.begin(), p.end(), g) == p.end());
+	std::vector<int> q(N);
+	for (int i = 0; i < N; ++i) {
+		q[i] = *p[i];
+	}
+	std::sort(q.begin(), q.end());
+	for (int i = 0; i < N; ++i) {
+		CHECK(q[i] == i);
+	}
+
+	// Small ranges and seq fall back to the sequential shuffle.
+	std::vector<int> w(100);
+	std::iota(w.begin(), w.end(), 0);
+	CHECK(stl2::shuffle(stl2::ext::execution::par, w.begin(), w.end()) == w.end());
+	CHECK(stl2::shuffle(stl2::ext::execution::seq, w) == w.end());
+	std::sort(w.begin(), w.end());
+	for (int i = 0; i < 100; ++i) {
+		CHECK(w[i] == i);
+	}
+}
 
 int main()
 {
+	test_bounded();
+	test_parallel();
+
 	{
 		int ia[100];
 		constexpr unsigned s = sizeof(ia)/sizeof(ia[0]);
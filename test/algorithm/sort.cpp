@@ -20,9 +20,12 @@
 
 #include <stl2/detail/algorithm/sort.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/execution.hpp>
+#include <stl2/view/zip.hpp>
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <vector>
 #include "../simple_test.hpp"
@@ -180,6 +183,106 @@ test_larger_sorts(unsigned N)
 	test_larger_sorts(N, N);
 }
 
+struct counting_less
+{
+	long* count;
+	bool operator()(int x, int y) const
+	{
+		++*count;
+		return x < y;
+	}
+};
+
+void
+test_adversarial_sorts(int N)
+{
+	// Each pattern must sort in O(N log N) comparisons.
+	auto check = [N](std::vector<int> v) {
+		long count = 0;
+		CHECK(stl2::sort(v, counting_less{&count}) == v.end());
+		CHECK(std::is_sorted(v.begin(), v.end()));
+		int lg = 1;
+		while ((1 << lg) < N) ++lg;
+		CHECK(count <= 4L * N * lg);
+	};
+	std::vector<int> v(N);
+	// all equal
+	std::fill(v.begin(), v.end(), 42);
+	check(v);
+	// organ pipe
+	for (int i = 0; i < N; ++i)
+		v[i] = i < N / 2 ? i : N - i;
+	check(v);
+	// sorted, with a few elements out of place
+	std::iota(v.begin(), v.end(), 0);
+	for (int i = 0; i < 8; ++i)
+		std::swap(v[gen() % N], v[gen() % N]);
+	check(v);
+	// sorted, with a random tail
+	std::iota(v.begin(), v.end(), 0);
+	std::shuffle(v.end() - N / 16, v.end(), gen);
+	check(v);
+	// many duplicates
+	for (auto& i : v)
+		i = gen() % 16;
+	check(v);
+	// median-of-3 killer
+	{
+		int k = N / 2;
+		for (int i = 1; i <= k; ++i)
+		{
+			v[i - 1] = (i % 2) ? i : k + i - 1;
+			v[k + i - 1] = 2 * i;
+		}
+		if (N % 2)
+			v[N - 1] = N;
+	}
+	check(v);
+	// reverse sorted, all keys distinct
+	for (int i = 0; i < N; ++i)
+		v[i] = N - i;
+	check(v);
+}
+
+void
+test_arithmetic_sorts(int N)
+{
+	// Arithmetic keys with the standard comparisons take the branchless
+	// partitioning path.
+	std::vector<double> v(N);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	for (auto& d : v)
+		d = dist(gen);
+	CHECK(stl2::sort(v) == v.end());
+	CHECK(std::is_sorted(v.begin(), v.end()));
+	std::shuffle(v.begin(), v.end(), gen);
+	CHECK(stl2::sort(v, stl2::greater<>{}) == v.end());
+	CHECK(std::is_sorted(v.begin(), v.end(), std::greater<>{}));
+	CHECK(stl2::sort(v, std::less<double>{}) == v.end());
+	CHECK(std::is_sorted(v.begin(), v.end()));
+
+	std::vector<unsigned char> c(N);
+	for (auto& i : c)
+		i = gen() % 4;
+	CHECK(stl2::sort(c, stl2::greater<>{}) == c.end());
+	CHECK(std::is_sorted(c.begin(), c.end(), std::greater<>{}));
+}
+
+void
+test_parallel_sorts(int N)
+{
+	std::vector<int> v(N);
+	for (auto& i : v)
+		i = gen() % (N / 4 + 1);
+	auto expected = v;
+	std::sort(expected.begin(), expected.end());
+	CHECK(stl2::sort(stl2::ext::execution::par, v) == v.end());
+	CHECK(v == expected);
+	std::shuffle(v.begin(), v.end(), gen);
+	CHECK(stl2::sort(stl2::ext::execution::par_unseq, v.begin(), v.end(), std::greater<int>{}) == v.end());
+	CHECK(std::is_sorted(v.begin(), v.end(), std::greater<int>{}));
+}
+
 struct S
 {
 	int i, j;
@@ -252,6 +355,15 @@ int main()
 	test_larger_sorts(1000);
 	test_larger_sorts(1009);
 
+	test_adversarial_sorts(1000);
+	test_adversarial_sorts(10007);
+
+	test_arithmetic_sorts(1000);
+	test_arithmetic_sorts(100003);
+
+	test_parallel_sorts(1000);
+	test_parallel_sorts(100003);
+
 	// Check move-only types
 	{
 		std::vector<std::unique_ptr<int> > v(1000);
@@ -294,31 +406,27 @@ int main()
 		}
 	}
 
-#if 0
 	// Check sorting a zip view, which uses iter_move
 	{
-		using namespace ranges;
-		std::vector<int> v0 =
-			view::for_each(view::ints(1,6) | view::reverse, [](int i){
-				return ranges::yield_from(view::repeat_n(i,i));
-			});
-		auto v1 = ranges::to_<std::vector<Int>>(
-			{1,2,2,3,3,3,4,4,4,4,5,5,5,5,5});
-		auto rng = view::zip(v0, v1);
+		std::vector<int> v0{5,5,5,5,5,4,4,4,4,3,3,3,2,2,1};
+		std::vector<Int> v1;
+		for (int i : {1,2,2,3,3,3,4,4,4,4,5,5,5,5,5}) {
+			v1.emplace_back(i);
+		}
+		auto rng = stl2::view::ext::zip(v0, v1);
 		CHECK_EQUAL(v0,{5,5,5,5,5,4,4,4,4,3,3,3,2,2,1});
 		CHECK_EQUAL(v1,{1,2,2,3,3,3,4,4,4,4,5,5,5,5,5});
 		using Rng = decltype(rng);
-		using CR = range_common_reference_t<Rng>;
+		using CR = stl2::iter_common_reference_t<stl2::iterator_t<Rng>>;
 		auto proj = [](CR r) { return r; };
 		auto pred = [](CR r1, CR r2) { return r1 < r2; };
-		sort(rng, pred, proj);
+		stl2::sort(rng, pred, proj);
 		CHECK_EQUAL(v0,{1,2,2,3,3,3,4,4,4,4,5,5,5,5,5});
 		CHECK_EQUAL(v1,{5,5,5,4,5,5,3,4,4,4,1,2,2,3,3});
 
 		// Check that this compiles, too:
-		sort(rng);
+		stl2::sort(rng);
 	}
-#endif
 
 	return ::test_result();
 }
@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/execution.hpp>
 #include <cassert>
 #include <memory>
 #include <random>
@@ -165,6 +166,38 @@ struct S
 	int i, j;
 };
 
+void
+test_parallel_sorts(int N)
+{
+	// Few distinct keys expose any instability in the run merges.
+	std::vector<S> v(N);
+	for (int i = 0; i < N; ++i)
+		v[i] = S{static_cast<int>(gen() % 100), i};
+	auto expected = v;
+	std::stable_sort(expected.begin(), expected.end(),
+		[](const S& x, const S& y) { return x.i < y.i; });
+	CHECK(stl2::stable_sort(stl2::ext::execution::par, v, std::less<int>{}, &S::i) == v.end());
+	for (int i = 0; i < N; ++i)
+	{
+		CHECK(v[i].i == expected[i].i);
+		CHECK(v[i].j == expected[i].j);
+	}
+
+	// Move-only elements
+	std::vector<std::unique_ptr<int>> p(N);
+	for (int i = 0; i < N; ++i)
+		p[i].reset(new int(N - i - 1));
+	stl2::stable_sort(stl2::ext::execution::par_unseq, p.begin(), p.end(), indirect_less());
+	for (int i = 0; i < N; ++i)
+		CHECK(*p[i] == i);
+
+	std::vector<int> w(N);
+	for (auto& i : w)
+		i = static_cast<int>(gen());
+	CHECK(stl2::stable_sort(stl2::ext::execution::seq, w, std::greater<int>{}) == w.end());
+	CHECK(std::is_sorted(w.begin(), w.end(), std::greater<int>{}));
+}
+
 int main()
 {
 	// test null range
@@ -192,6 +225,10 @@ int main()
 	test_larger_sorts(1000);
 	test_larger_sorts(1009);
 
+	test_parallel_sorts(0);
+	test_parallel_sorts(1000);
+	test_parallel_sorts(100003);
+
 	// Check move-only types
 	{
 		std::vector<std::unique_ptr<int> > v(1000);
@@ -14,6 +14,7 @@
 
 #include <experimental/ranges/algorithm>
 #include <experimental/ranges/concepts>
+#include <experimental/ranges/execution>
 #include <experimental/ranges/functional>
 #include <experimental/ranges/iterator>
 #include <experimental/ranges/memory>
@@ -24,6 +25,7 @@
 #include <experimental/ranges/utility>
 #include <stl2/algorithm.hpp>
 #include <stl2/concepts.hpp>
+#include <stl2/execution.hpp>
 #include <stl2/functional.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/memory.hpp>
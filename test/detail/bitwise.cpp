@@ -0,0 +1,229 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/bitwise.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/copy_backward.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/detail/algorithm/fill_n.hpp>
+#include <stl2/detail/algorithm/move.hpp>
+#include <stl2/detail/algorithm/move_backward.hpp>
+#include <stl2/detail/memory/uninitialized_copy.hpp>
+#include <stl2/iterator.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace stl2 = __stl2;
+namespace bitwise = stl2::detail::bitwise;
+
+namespace {
+	struct pod {
+		int i;
+		double d;
+		friend bool operator==(const pod& x, const pod& y) {
+			return x.i == y.i && x.d == y.d;
+		}
+	};
+
+	template<class T>
+	std::vector<T> iota(int n) {
+		std::vector<T> v(n);
+		for (int i = 0; i < n; ++i) {
+			v[i] = static_cast<T>(i);
+		}
+		return v;
+	}
+
+	void test_copy() {
+		auto const src = iota<int>(100);
+		std::vector<int> dst(100);
+		const int* const s = src.data();
+		int* const d = dst.data();
+
+		auto r = stl2::copy(s, s + 100, d);
+		CHECK(r.in() == s + 100);
+		CHECK(r.out() == d + 100);
+		CHECK(dst == src);
+
+		// Through counted_iterator and default_sentinel.
+		dst.assign(100, 0);
+		auto c = stl2::copy(stl2::make_counted_iterator(s + 10, 50), stl2::default_sentinel{},
+			stl2::make_counted_iterator(d, 50));
+		CHECK(c.in().base() == s + 60);
+		CHECK(c.in().count() == 0);
+		CHECK(c.out().base() == d + 50);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(dst[i] == (i < 50 ? i + 10 : 0));
+		}
+
+		// Both reversed: still element-for-element.
+		dst.assign(100, 0);
+		using RI = stl2::reverse_iterator<const int*>;
+		using RO = stl2::reverse_iterator<int*>;
+		auto rr = stl2::copy(RI{s + 90}, RI{s + 10}, RO{d + 80});
+		CHECK(rr.in().base() == s + 10);
+		CHECK(rr.out().base() == d);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(dst[i] == (i < 80 ? i + 10 : 0));
+		}
+
+		// Only the input reversed: reverses the elements.
+		dst.assign(100, 0);
+		auto ro = stl2::copy(RI{s + 100}, RI{s}, d);
+		CHECK(ro.out() == d + 100);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(dst[i] == 99 - i);
+		}
+
+		// Overlapping, as copy permits when result is before first.
+		dst = src;
+		stl2::copy(d + 10, d + 100, d);
+		for (int i = 0; i < 90; ++i) {
+			CHECK(dst[i] == i + 10);
+		}
+
+		// A range of one element and an empty range.
+		dst = src;
+		CHECK(stl2::copy(s + 5, s + 6, d).out() == d + 1);
+		CHECK(dst[0] == 5);
+		CHECK(stl2::copy(s, s, d).out() == d);
+		CHECK(dst[0] == 5);
+	}
+
+	void test_move() {
+		std::vector<pod> src(50);
+		for (int i = 0; i < 50; ++i) {
+			src[i] = {i, i * 0.5};
+		}
+		std::vector<pod> dst(50);
+		auto r = stl2::move(src.data(), src.data() + 50, dst.data());
+		CHECK(r.in() == src.data() + 50);
+		CHECK(r.out() == dst.data() + 50);
+		CHECK(dst == src);
+
+		std::vector<pod> dst2(50);
+		auto m = stl2::copy(stl2::make_move_iterator(src.data()),
+			stl2::make_move_iterator(src.data() + 50), dst2.data());
+		CHECK(m.in().base() == src.data() + 50);
+		CHECK(dst2 == src);
+
+		// Non-trivial types keep their element-wise semantics.
+		std::vector<std::string> strs = {"a", "bb", "ccc"};
+		std::vector<std::string> out(3);
+		stl2::move(strs.data(), strs.data() + 3, out.data());
+		CHECK(out[2] == "ccc");
+		CHECK(strs[2].empty());
+	}
+
+	void test_backward() {
+		auto v = iota<int>(100);
+		int* const p = v.data();
+		auto r = stl2::copy_backward(p, p + 90, p + 100);
+		CHECK(r.in() == p + 90);
+		CHECK(r.out() == p + 10);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(v[i] == (i < 10 ? i : i - 10));
+		}
+
+		v = iota<int>(100);
+		int* const q = v.data();
+		auto m = stl2::move_backward(q, q + 50, q + 75);
+		CHECK(m.in() == q + 50);
+		CHECK(m.out() == q + 25);
+		for (int i = 25; i < 75; ++i) {
+			CHECK(v[i] == i - 25);
+		}
+	}
+
+	template<class T>
+	void test_fill(T value) {
+		for (int n : {0, 1, 2, 31, 1000}) {
+			std::vector<T> v(n + 2, T(7));
+			T* const p = v.data() + 1;
+			CHECK(stl2::fill(p, p + n, value) == p + n);
+			CHECK(v.front() == T(7));
+			CHECK(v.back() == T(7));
+			for (int i = 0; i < n; ++i) {
+				CHECK(p[i] == value);
+			}
+			v.assign(n + 2, T(7));
+			CHECK(stl2::fill_n(p, n, value) == p + n);
+			CHECK(v.back() == T(7));
+			for (int i = 0; i < n; ++i) {
+				CHECK(p[i] == value);
+			}
+		}
+		CHECK(stl2::fill_n(static_cast<T*>(nullptr), -1, value) == nullptr);
+	}
+
+	void test_fill_wrapped() {
+		std::vector<int> v(100, 0);
+		using R = stl2::reverse_iterator<int*>;
+		CHECK(stl2::fill(R{v.data() + 60}, R{v.data() + 20}, 3).base() == v.data() + 20);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(v[i] == (i >= 20 && i < 60 ? 3 : 0));
+		}
+		auto c = stl2::fill(stl2::make_counted_iterator(v.data(), 10), stl2::default_sentinel{}, 'x');
+		CHECK(c.base() == v.data() + 10);
+		CHECK(v[9] == 'x');
+		CHECK(v[10] == 0);
+	}
+
+	void test_uninitialized_copy() {
+		auto const src = iota<double>(64);
+		std::allocator<double> alloc;
+		double* const p = alloc.allocate(64);
+		auto r = stl2::uninitialized_copy(src.data(), src.data() + 64, p, p + 32);
+		CHECK(r.in() == src.data() + 32);
+		CHECK(r.out() == p + 32);
+		auto n = stl2::uninitialized_copy_n(src.data() + 32, 32, p + 32);
+		CHECK(n.in() == src.data() + 64);
+		CHECK(n.out() == p + 64);
+		for (int i = 0; i < 64; ++i) {
+			CHECK(p[i] == src[i]);
+		}
+		alloc.deallocate(p, 64);
+	}
+}
+
+int main() {
+	test_copy();
+	test_move();
+	test_backward();
+	test_fill<char>(42);
+	test_fill<short>(-2);
+	test_fill<int>(-1);
+	test_fill<int>(0);
+	test_fill<double>(0.0);
+	test_fill<double>(-0.0);
+	test_fill<double>(2.5);
+	test_fill_wrapped();
+	test_uninitialized_copy();
+
+	using RI = stl2::reverse_iterator<int*>;
+	static_assert(bitwise::Assignable<const int*, int*>);
+	static_assert(bitwise::Assignable<RI, RI>);
+	static_assert(bitwise::Assignable<stl2::reverse_iterator<RI>, int*>);
+	static_assert(bitwise::Assignable<stl2::counted_iterator<int*>, int*>);
+	static_assert(bitwise::Assignable<stl2::move_iterator<pod*>, pod*,
+		stl2::iter_reference_t<stl2::move_iterator<pod*>>>);
+	static_assert(!bitwise::Assignable<RI, int*>);
+	static_assert(!bitwise::Assignable<int*, const int*>);
+	static_assert(!bitwise::Assignable<int*, long*>);
+	static_assert(!bitwise::Assignable<volatile int*, int*>);
+	static_assert(!bitwise::Assignable<std::string*, std::string*>);
+	static_assert(bitwise::Fillable<char*, int>);
+	static_assert(!bitwise::Fillable<std::string*, const char*>);
+
+	return ::test_result();
+}
@@ -0,0 +1,222 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/simd.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/mismatch.hpp>
+#include <stl2/detail/iterator/basic_iterator.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace stl2 = __stl2;
+namespace simd = stl2::detail::simd;
+
+namespace {
+	// A contiguous iterator over ints that counts the elements read
+	// through it. The kernels read through the address instead, so a
+	// search that reads nothing ran one.
+	class counting_cursor {
+	public:
+		using contiguous = std::true_type;
+
+		counting_cursor() = default;
+		constexpr counting_cursor(const int* p, int* reads) noexcept
+		: p_{p}, reads_{reads} {}
+
+		constexpr const int& read() const noexcept {
+			++*reads_;
+			return *p_;
+		}
+		constexpr const int* arrow() const noexcept { return p_; }
+		constexpr void next() noexcept { ++p_; }
+		constexpr void prev() noexcept { --p_; }
+		constexpr void advance(std::ptrdiff_t n) noexcept { p_ += n; }
+		constexpr bool equal(const counting_cursor& that) const noexcept {
+			return p_ == that.p_;
+		}
+		constexpr std::ptrdiff_t distance_to(const counting_cursor& that) const noexcept {
+			return that.p_ - p_;
+		}
+
+	private:
+		const int* p_ = nullptr;
+		int* reads_ = nullptr;
+	};
+	using counting_iterator = stl2::basic_iterator<counting_cursor>;
+
+	constexpr bool in_constant_evaluation() {
+		int const a[] = {1, 2, 3};
+		return simd::constant_evaluated(a + 0, 3);
+	}
+
+#if STL2_CONSTEXPR_EXTENSIONS
+	// The reads made by the scalar loops, which are all that constant
+	// evaluation can run.
+	constexpr int constant_reads() {
+		int const a[] = {1, 2, 3, 4, 5, 6, 7, 8};
+		int const b[] = {1, 2, 3, 4, 0, 6, 7, 8};
+		int reads = 0;
+		auto const i = [&](const int* p) { return counting_iterator{counting_cursor{p, &reads}}; };
+		int result = 0;
+		result += stl2::find(i(a), i(a + 8), 6) == i(a + 5);
+		result += stl2::count(i(a), i(a + 8), 6) == 1;
+		result += !stl2::equal(i(a), i(a + 8), i(b), i(b + 8));
+		result += stl2::mismatch(i(a), i(a + 8), i(b), i(b + 8)).in1() == i(a + 4);
+		return result == 4 ? reads : -1;
+	}
+#endif
+
+	template<class T>
+	const T* scalar_find(const T* first, const T* last, T value) {
+		for (; first != last && !(*first == value); ++first) {}
+		return first;
+	}
+
+	template<class T>
+	std::ptrdiff_t scalar_count(const T* first, const T* last, T value) {
+		std::ptrdiff_t n = 0;
+		for (; first != last; ++first) {
+			n += *first == value;
+		}
+		return n;
+	}
+
+	template<class T>
+	void test_type() {
+		// Odd lengths and offsets exercise the unaligned heads and the
+		// scalar tails.
+		for (int n = 0; n < 150; n += (n < 70 ? 1 : 7)) {
+			std::vector<T> storage(n + 1);
+			T* const v = storage.data() + 1;
+			for (int i = 0; i < n; ++i) {
+				v[i] = static_cast<T>(i % 37);
+			}
+			for (int k = 0; k < 40; k += 3) {
+				auto const value = static_cast<T>(k);
+				auto const p = scalar_find<T>(v, v + n, value);
+				CHECK(stl2::find(v, v + n, value) == p);
+				CHECK(simd::find<T>(v, v + n, value) == p);
+				auto const c = scalar_count<T>(v, v + n, value);
+				CHECK(stl2::count(v, v + n, value) == c);
+				CHECK(simd::count<T>(v, v + n, value) == c);
+#if STL2_SIMD_X86
+				CHECK(simd::find_impl<simd::sse2>(static_cast<const T*>(v), v + n, value) == p);
+				CHECK(simd::count_impl<simd::sse2>(static_cast<const T*>(v), v + n, value) == c);
+#endif
+			}
+
+			std::vector<T> w(v, v + n);
+			CHECK(stl2::equal(v, v + n, w.data(), w.data() + n));
+			CHECK(stl2::mismatch(v, v + n, w.data(), w.data() + n).in1() == v + n);
+			for (int i = 0; i < n; i += 5) {
+				w[i] = static_cast<T>(100);
+				CHECK(!stl2::equal(v, v + n, w.data(), w.data() + n));
+				auto const m = stl2::mismatch(v, v + n, w.data(), w.data() + n);
+				CHECK(m.in1() == v + i);
+				CHECK(m.in2() == w.data() + i);
+#if STL2_SIMD_X86
+				CHECK(simd::mismatch_impl<simd::sse2>(static_cast<const T*>(v),
+					static_cast<const T*>(w.data()), n) == i);
+#endif
+				w[i] = v[i];
+			}
+		}
+	}
+
+	template<class T>
+	void test_floating_point() {
+		constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+		std::vector<T> v(100, T(1));
+		v[40] = nan;
+		v[70] = T(-0.0);
+		CHECK(stl2::find(v.data(), v.data() + v.size(), nan) == v.data() + v.size());
+		CHECK(stl2::count(v.data(), v.data() + v.size(), nan) == 0);
+		CHECK(stl2::find(v.data(), v.data() + v.size(), T(0.0)) == v.data() + 70);
+
+		// NaN is unequal to itself, and -0.0 equals +0.0.
+		auto w = v;
+		CHECK(!stl2::equal(v.data(), v.data() + v.size(), w.data(), w.data() + w.size()));
+		CHECK(stl2::mismatch(v.data(), v.data() + v.size(), w.data(), w.data() + w.size()).in1() ==
+			v.data() + 40);
+		v[40] = w[40] = T(2);
+		w[70] = T(0.0);
+		CHECK(stl2::equal(v.data(), v.data() + v.size(), w.data(), w.data() + w.size()));
+	}
+}
+
+int main() {
+	test_type<char>();
+	test_type<unsigned char>();
+	test_type<std::int16_t>();
+	test_type<std::uint32_t>();
+	test_type<int>();
+	test_type<std::int64_t>();
+	test_type<float>();
+	test_type<double>();
+	test_floating_point<float>();
+	test_floating_point<double>();
+
+	{
+		// The kernels run whenever the data isn't constant, with or
+		// without __builtin_is_constant_evaluated...
+		static_assert(stl2::ContiguousIterator<counting_iterator>);
+		static_assert(simd::Searchable<counting_iterator, counting_iterator, int, stl2::identity>);
+		std::vector<int> a(100), b(100);
+		for (int k = 0; k < 100; ++k) {
+			a[k] = b[k] = k;
+		}
+		b[60] = -1;
+		int reads = 0;
+		auto const i = [&](const int* p) { return counting_iterator{counting_cursor{p, &reads}}; };
+		CHECK(stl2::find(i(a.data()), i(a.data() + 100), 42) == i(a.data() + 42));
+		CHECK(stl2::count(i(a.data()), i(a.data() + 100), 42) == 1);
+		CHECK(!stl2::equal(i(a.data()), i(a.data() + 100), i(b.data()), i(b.data() + 100)));
+		CHECK(stl2::mismatch(i(a.data()), i(a.data() + 100),
+			i(b.data()), i(b.data() + 100)).in2() == i(b.data() + 60));
+		CHECK(reads == 0);
+		CHECK(!simd::constant_evaluated(a.data(), 100));
+
+		// ...and never during constant evaluation.
+		static_assert(in_constant_evaluation());
+#if STL2_CONSTEXPR_EXTENSIONS
+		// find reads 6 elements, count 8, equal and mismatch 5 of each range.
+		static_assert(constant_reads() == 6 + 8 + 10 + 10);
+#endif
+	}
+	{
+		// Projections and non-pointer iterators take the scalar path.
+		int a[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+		using I = random_access_iterator<int*>;
+		CHECK(stl2::find(I{a}, I{a + 10}, 7).base() == a + 7);
+		CHECK(stl2::count(a, a + 10, 14, [](int i) { return i * 2; }) == 1);
+	}
+
+	static_assert(simd::Searchable<int*, int*, int, stl2::identity>);
+	static_assert(simd::Searchable<const double*, const double*, const double&, stl2::identity>);
+	static_assert(!simd::Searchable<int*, int*, long, stl2::identity>);
+	static_assert(!simd::Searchable<bool*, bool*, bool, stl2::identity>);
+	static_assert(!simd::Searchable<random_access_iterator<int*>, random_access_iterator<int*>,
+		int, stl2::identity>);
+	static_assert(simd::Comparable<int*, const int*, stl2::equal_to<>,
+		stl2::identity, stl2::identity>);
+	static_assert(!simd::Comparable<int*, int*, stl2::less<>,
+		stl2::identity, stl2::identity>);
+	static_assert(!simd::Comparable<int*, long*, stl2::equal_to<>,
+		stl2::identity, stl2::identity>);
+
+	return ::test_result();
+}
@@ -0,0 +1,73 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/execution/thread_pool.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../simple_test.hpp"
+
+using __stl2::detail::thread_pool;
+
+int main() {
+	{
+		thread_pool pool{1};
+		CHECK(pool.concurrency() == 1);
+		std::vector<int> v(100);
+		auto f = [&](std::ptrdiff_t i) { v[i] = static_cast<int>(i); };
+		pool.bulk(100, f);
+		for (int i = 0; i < 100; ++i) {
+			CHECK(v[i] == i);
+		}
+	}
+	{
+		thread_pool pool{4};
+		CHECK(pool.concurrency() == 4);
+
+		// Every index is visited exactly once.
+		std::vector<std::atomic<int>> hits(10000);
+		auto f = [&](std::ptrdiff_t i) { ++hits[i]; };
+		for (int rep = 0; rep < 20; ++rep) {
+			pool.bulk(static_cast<std::ptrdiff_t>(hits.size()), f);
+		}
+		for (auto& h : hits) {
+			CHECK(h.load() == 20);
+		}
+
+		// Empty jobs are no-ops.
+		pool.bulk(0, f);
+
+		// Nested jobs complete.
+		std::atomic<int> inner{0};
+		auto g = [&](std::ptrdiff_t) {
+			auto h = [&](std::ptrdiff_t) { ++inner; };
+			pool.bulk(10, h);
+		};
+		pool.bulk(50, g);
+		CHECK(inner.load() == 500);
+
+		// Jobs may be submitted from several threads at once.
+		std::atomic<long> sum{0};
+		auto submit = [&] {
+			auto s = [&](std::ptrdiff_t i) { sum += i; };
+			for (int rep = 0; rep < 50; ++rep) {
+				pool.bulk(1000, s);
+			}
+		};
+		std::thread t1{submit}, t2{submit};
+		submit();
+		t1.join();
+		t2.join();
+		CHECK(sum.load() == 3L * 50 * (999L * 1000 / 2));
+	}
+
+	return ::test_result();
+}
@@ -10,6 +10,8 @@
 // Project home: https://github.com/caseycarter/cmcstl2
 //
 #include <stl2/detail/iterator/any_iterator.hpp>
+#include <stl2/detail/iterator/counted_iterator.hpp>
+#include <cstddef>
 #include <iterator>
 #include <iostream>
 #include <string>
@@ -56,8 +58,71 @@ void test_big() {
 	}
 }
 
+struct big_iterator {
+	using iterator_category = stl2::input_iterator_tag;
+	using value_type = int;
+	using difference_type = std::ptrdiff_t;
+	int* p;
+	char pad[64];
+	int& operator*() const { return *p; }
+	big_iterator& operator++() { ++p; return *this; }
+	void operator++(int) { ++p; }
+	bool operator==(big_iterator const& that) const { return p == that.p; }
+	bool operator!=(big_iterator const& that) const { return p != that.p; }
+};
+
+void test_buffer() {
+	int rg[]{0,1,2,3,4};
+	// A big enough buffer keeps the iterator in place, so copies are
+	// independent.
+	using Inline = stl2::ext::basic_any_input_iterator<int&, sizeof(big_iterator)>;
+	static_assert(stl2::InputIterator<Inline>);
+	Inline first{big_iterator{rg, {}}};
+	auto copy = first;
+	++first;
+	CHECK(*first == 1);
+	CHECK(*copy == 0);
+	CHECK(first == Inline{big_iterator{rg + 1, {}}});
+
+	// Otherwise copies share the one on the heap.
+	using Shared = stl2::ext::basic_any_input_iterator<int&, 16, false>;
+	Shared s{big_iterator{rg, {}}};
+	auto alias = s;
+	++s;
+	CHECK(*alias == 1);
+	int i = 1;
+	for (Shared const last{big_iterator{rg + 5, {}}}; s != last; ++s, ++i) {
+		CHECK(*s == i);
+	}
+	CHECK(i == 5);
+	alias = Shared{};
+	s = std::move(alias);
+}
+
+void test_default_sentinel() {
+	// Only a bounded erasure compares with default_sentinel, and only
+	// iterators that know their own end can be erased by one.
+	using AI = stl2::any_input_iterator<int&>;
+	using BI = stl2::ext::basic_any_bounded_input_iterator<int&>;
+	static_assert(!stl2::Sentinel<stl2::default_sentinel, AI>);
+	static_assert(stl2::Sentinel<stl2::default_sentinel, BI>);
+	static_assert(stl2::Constructible<BI, stl2::counted_iterator<int*>>);
+	static_assert(!stl2::Constructible<BI, int*>);
+
+	int rg[]{0,1,2,3,4,5,6,7,8,9};
+	BI first{stl2::make_counted_iterator(rg, 4)};
+	int i = 0;
+	for (; first != stl2::default_sentinel{}; ++first, ++i) {
+		CHECK(*first == i);
+	}
+	CHECK(i == 4);
+	CHECK(BI{} == stl2::default_sentinel{});
+}
+
 int main() {
 	test_small();
 	test_big();
+	test_buffer();
+	test_default_sentinel();
 	return ::test_result();
 }
@@ -11,6 +11,7 @@
 // Project home: https://github.com/caseycarter/cmcstl2
 //
 #include <algorithm>
+#include <memory>
 #include <numeric>
 #include <stl2/iterator.hpp>
 #include "../simple_test.hpp"
@@ -89,6 +90,77 @@ namespace {
 		}
 	}
 
+	// A sentinel that isn't trivially copyable, to exercise the general
+	// storage; its use_count tells how many copies are alive.
+	struct shared_sentinel {
+		std::shared_ptr<const int*> end_;
+
+		friend bool operator==(const int* i, const shared_sentinel& s) { return i == *s.end_; }
+		friend bool operator!=(const int* i, const shared_sentinel& s) { return !(i == s); }
+		friend bool operator==(const shared_sentinel& s, const int* i) { return i == s; }
+		friend bool operator!=(const shared_sentinel& s, const int* i) { return !(i == s); }
+		friend std::ptrdiff_t operator-(const int* i, const shared_sentinel& s) { return i - *s.end_; }
+		friend std::ptrdiff_t operator-(const shared_sentinel& s, const int* i) { return *s.end_ - i; }
+	};
+
+	void test_storage() {
+		using ranges::common_iterator;
+		using ranges::counted_iterator;
+		using ranges::default_sentinel;
+		using ranges::unreachable;
+
+		// An empty sentinel takes no room beyond the flag.
+		static_assert(sizeof(common_iterator<counted_iterator<int*>, default_sentinel>) ==
+			sizeof(counted_iterator<int*>) + alignof(counted_iterator<int*>));
+		static_assert(sizeof(common_iterator<int*, unreachable>) == 2 * sizeof(int*));
+		static_assert(std::is_trivially_copyable<common_iterator<int*, unreachable>>::value);
+		static_assert(std::is_trivially_copyable<common_iterator<int*, sentinel<int*>>>::value);
+		static_assert(!std::is_trivially_copyable<common_iterator<const int*, shared_sentinel>>::value);
+
+		{
+			int rgi[] {0, 1, 2, 3, 4};
+			using CI = common_iterator<int*, unreachable>;
+			CI first{rgi};
+			CI last{unreachable{}};
+			CHECK(first != last);
+			CHECK(last == CI{unreachable{}});
+			CHECK(*++first == 1);
+			first = last;
+			CHECK(first == last);
+			first = CI{rgi + 4};
+			CHECK(*first == 4);
+		}
+		{
+			int const rgi[] {0, 1, 2, 3, 4};
+			auto const end = std::make_shared<const int*>(rgi + 5);
+			using CI = common_iterator<const int*, shared_sentinel>;
+			{
+				CI first{rgi};
+				CI last{shared_sentinel{end}};
+				CHECK(end.use_count() == 2);
+				CHECK(std::accumulate(first, last, 0) == 10);
+				CHECK((last - first) == 5);
+				CHECK((first - last) == -5);
+				CHECK((last - last) == 0);
+
+				CI it = last;
+				CHECK(end.use_count() == 3);
+				CHECK(it == last);
+				it = first;
+				CHECK(end.use_count() == 2);
+				CHECK(it == first);
+				++it;
+				CHECK((it - first) == 1);
+				it = std::move(last);
+				CHECK(it != first);
+				CHECK(it == CI{rgi + 5});
+				last = CI{rgi + 2};
+				CHECK((it - last) == 3);
+			}
+			CHECK(end.use_count() == 1);
+		}
+	}
+
 	void test_constexpr() {
 		static int i = 42;
 
@@ -180,6 +252,7 @@ int main() {
 		CHECK(ci2 != ci);
 	}
 	test_operator_arrow();
+	test_storage();
 	test_constexpr();
 
 	return test_result();
@@ -0,0 +1,110 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/iterator.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/mismatch.hpp>
+#include <stl2/view/counted.hpp>
+#include <stl2/view/drop.hpp>
+#include <stl2/view/reverse.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/take_exactly.hpp>
+#include <array>
+#include <deque>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace stl2 = __stl2;
+
+using VI = std::vector<int>::iterator;
+using VCI = std::vector<int>::const_iterator;
+
+static_assert(stl2::ContiguousIterator<int*>);
+static_assert(stl2::ContiguousIterator<VI>);
+static_assert(stl2::ContiguousIterator<VCI>);
+static_assert(stl2::ContiguousIterator<std::string::iterator>);
+static_assert(stl2::ContiguousIterator<std::array<int, 4>::iterator>);
+static_assert(stl2::ContiguousIterator<stl2::counted_iterator<VI>>);
+static_assert(!stl2::ContiguousIterator<std::deque<int>::iterator>);
+static_assert(!stl2::ContiguousIterator<std::vector<bool>::iterator>);
+static_assert(!stl2::ContiguousIterator<stl2::reverse_iterator<int*>>);
+static_assert(!stl2::ContiguousIterator<stl2::move_iterator<int*>>);
+
+static_assert(stl2::ContiguousRange<std::vector<int>&>);
+static_assert(stl2::ContiguousRange<stl2::subrange<VI>>);
+static_assert(!stl2::ContiguousRange<std::deque<int>&>);
+
+int main() {
+	std::vector<int> v = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	int* const p = v.data();
+
+	// to_address is valid for the end of a range.
+	CHECK(stl2::ext::to_address(v.begin()) == p);
+	CHECK(stl2::ext::to_address(v.end()) == p + 10);
+	CHECK(stl2::ext::to_address(v.cend()) == p + 10);
+	CHECK(stl2::ext::to_address(p + 3) == p + 3);
+	{
+		stl2::counted_iterator<VI> i{v.begin() + 2, 8};
+		CHECK(stl2::ext::to_address(i) == p + 2);
+		CHECK(i.operator->() == p + 2);
+		CHECK(stl2::ext::to_address(i + 8) == p + 10);
+	}
+	static_assert(noexcept(stl2::ext::to_address(v.begin())));
+
+	// Views over contiguous iterators have data().
+	{
+		auto s = stl2::subrange{v.begin() + 1, v.end()};
+		CHECK(s.data() == p + 1);
+		auto t = stl2::view::take(v, 4);
+		CHECK(t.data() == p);
+		auto te = stl2::view::ext::take_exactly(v, 4);
+		CHECK(te.data() == p);
+		auto d = stl2::view::ext::drop(v, 3);
+		CHECK(d.data() == p + 3);
+		auto c = stl2::view::counted(v.begin() + 5, 2);
+		CHECK(c.data() == p + 5);
+		CHECK(stl2::data(c) == p + 5);
+		auto e = stl2::subrange{v.end(), v.end()};
+		CHECK(e.data() == nullptr);
+		using R = decltype(stl2::view::reverse(v));
+		static_assert(!stl2::ContiguousRange<R>);
+	}
+
+	// Algorithms take their raw-pointer fast paths through the wrappers.
+	{
+		CHECK(stl2::find(v.begin(), v.end(), 7) == v.begin() + 7);
+		CHECK(stl2::find(v, 42) == v.end());
+		CHECK(stl2::count(v.cbegin(), v.cend(), 3) == 1);
+		std::vector<int> w(10);
+		CHECK(stl2::copy(v, w.begin()).out() == w.end());
+		CHECK(stl2::equal(v, w));
+		w[6] = -1;
+		auto m = stl2::mismatch(v, w);
+		CHECK(m.in1() == v.begin() + 6);
+		CHECK(m.in2() == w.begin() + 6);
+
+		auto c = stl2::view::counted(v.begin() + 2, 5);
+		CHECK(stl2::find(c, 4).base() == v.begin() + 4);
+		CHECK(stl2::find(c, 9) == stl2::end(c));
+		CHECK(stl2::count(c, 9) == 0);
+
+		std::vector<int> empty;
+		CHECK(stl2::find(empty, 0) == empty.end());
+		CHECK(stl2::equal(empty, empty));
+	}
+
+	return ::test_result();
+}
@@ -12,7 +12,10 @@
 #include <stl2/detail/iterator/ostream_iterator.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/utility.hpp>
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <string>
 #include "../simple_test.hpp"
 
 using namespace __stl2;
@@ -26,6 +29,70 @@ namespace {
 		}
 		return {first, out};
 	}
+
+	// Writes values through ostream_iterator and buffered_ostream_iterator
+	// on streams prepared by setup, and checks that the output and the
+	// stream states agree.
+	template<class T, class F>
+	void check_buffered(std::initializer_list<T> values, F setup, const char* delim = " ") {
+		std::ostringstream expected, actual;
+		setup(expected);
+		setup(actual);
+		::copy(__stl2::begin(values), __stl2::end(values),
+			ostream_iterator<T>{expected, delim});
+		::copy(__stl2::begin(values), __stl2::end(values),
+			ext::buffered_ostream_iterator<T>{actual, delim});
+		CHECK(actual.str() == expected.str());
+		CHECK(actual.rdstate() == expected.rdstate());
+	}
+
+	template<class T>
+	void check_buffered(std::initializer_list<T> values) {
+		using L = std::numeric_limits<T>;
+		auto const plain = [](std::ostream&) {};
+		check_buffered(values, plain);
+		check_buffered({L::min(), L::max(), L::lowest(), T(0), T(1), T(-1)}, plain);
+		check_buffered(values, plain, nullptr);
+		check_buffered(values, [](std::ostream& os) { os << std::hex; });
+		check_buffered(values, [](std::ostream& os) { os << std::showpos; });
+		check_buffered(values, [](std::ostream& os) { os.width(10); });
+		check_buffered(values, [](std::ostream& os) { os.setstate(std::ios_base::failbit); });
+		for (int p : {0, 1, 3, 17, 21, 40, 60}) {
+			check_buffered(values, [p](std::ostream& os) { os.precision(p); });
+		}
+	}
+
+	// A streambuf with a small put area that keeps what is written to it,
+	// and fails once it holds limit characters.
+	struct small_buf : std::streambuf {
+		std::string str;
+		std::size_t limit = std::size_t(-1);
+		char area[8];
+
+		small_buf() { setp(area, area + sizeof(area)); }
+
+		int_type overflow(int_type c) override {
+			if (!drain()) {
+				return traits_type::eof();
+			}
+			if (!traits_type::eq_int_type(c, traits_type::eof())) {
+				sputc(traits_type::to_char_type(c));
+			}
+			return traits_type::not_eof(c);
+		}
+		int sync() override {
+			return drain() ? 0 : -1;
+		}
+		bool drain() {
+			str.append(pbase(), pptr());
+			setp(area, area + sizeof(area));
+			if (str.size() >= limit) {
+				str.resize(limit);
+				return false;
+			}
+			return true;
+		}
+	};
 }
 
 int main() {
@@ -75,5 +142,75 @@ int main() {
 
 	ostream_iterator<std::string>{std::cout} = "Hello, World!\n";
 
+	{
+		using B = ext::buffered_ostream_iterator<int>;
+		static_assert(OutputIterator<B, const int&>);
+		static_assert(!InputIterator<B>);
+		static_assert(noexcept(B{}));
+
+		check_buffered<short>({0, 7, -1, 12345, -32768});
+		check_buffered<unsigned short>({0, 7, 65535});
+		check_buffered<int>({0, 7, 1, 6, 2, 5, 3, 4, -42, 1000000});
+		check_buffered<unsigned>({0, 7, 4000000000u});
+		check_buffered<long>({0, -7, 1234567890123L});
+		check_buffered<unsigned long>({0, 7, 18446744073709551615ul});
+		check_buffered<long long>({0, -7, -9223372036854775807LL});
+		check_buffered<unsigned long long>({0, 7, 12345678901234567890ull});
+
+		auto const inf = std::numeric_limits<double>::infinity();
+		auto const nan = std::numeric_limits<double>::quiet_NaN();
+		check_buffered<float>({0.f, -0.f, 1.5f, 0.1f, 3.14159265f, 1e-7f, 1e30f,
+			float(inf), float(-inf), float(nan), std::numeric_limits<float>::denorm_min()});
+		check_buffered<double>({0., -0., 1.5, 0.1, 3.14159265358979, 1e-300, 1e300,
+			123456789., 0.0001, 0.00001, inf, -inf, nan,
+			std::numeric_limits<double>::denorm_min()});
+		check_buffered<long double>({0.L, 1.5L, 0.1L, 1e-4000L, 1e4000L, 3.14159265358979323846L});
+
+		// void accepts anything, and formats the numbers fast.
+		std::ostringstream os;
+		ext::buffered_ostream_iterator<> v{os, ","};
+		*v++ = 42;
+		*v++ = "text";
+		*v++ = 'c';
+		*v++ = true;
+		*v++ = 2.5;
+		CHECK(os.str() == "42,text,c,1,2.5,");
+
+		// The stream's formatting is looked at for each value.
+		os.str("");
+		*v++ = 255;
+		os << std::hex;
+		*v++ = 255;
+		os << std::dec;
+		os.precision(2);
+		*v++ = 3.14159;
+		CHECK(os.str() == "255,ff,3.1,");
+	}
+	{
+		// Output that doesn't fit the put area is sent to the streambuf.
+		small_buf buf;
+		std::ostream os{&buf};
+		ext::buffered_ostream_iterator<long> i{os, ", "};
+		std::string expected;
+		for (long n = -5000; n < 5000; n += 7) {
+			*i++ = n;
+			expected += std::to_string(n) + ", ";
+		}
+		os.flush();
+		CHECK(buf.str == expected);
+		CHECK(os.good());
+
+		// A failing streambuf sets badbit, as with operator<<.
+		small_buf bad;
+		bad.limit = 20;
+		std::ostream bos{&bad};
+		ext::buffered_ostream_iterator<long> j{bos, ","};
+		for (long n = 0; n < 100; ++n) {
+			*j++ = n * 1000;
+		}
+		CHECK(bos.bad());
+		CHECK(bad.str == "0,1000,2000,3000,400");
+	}
+
 	return ::test_result();
 }
@@ -10,28 +10,42 @@
 // Project home: https://github.com/caseycarter/cmcstl2
 //
 #include <stl2/detail/iterator/ostreambuf_iterator.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/iterator.hpp>
 #include <stl2/type_traits.hpp>
+#include <algorithm>
 #include <sstream>
+#include <string>
 #include "../simple_test.hpp"
 
 using namespace __stl2;
 
 namespace {
-	template<InputIterator I, Sentinel<I> S, OutputIterator<iter_reference_t<I>> O>
-	tagged_pair<tag::in(I), tag::out(O)>
-	constexpr copy(I first, S last, O out) {
-		for (; first != last; ++first, void(), ++out) {
-			*out = *first;
-		}
-		return {first, out};
-	}
+	// An unbuffered streambuf that counts the calls of its virtuals and
+	// takes at most limit characters.
+	struct counting_buf : std::streambuf {
+		std::string str;
+		std::size_t limit = std::size_t(-1);
+		int overflows = 0, xsputns = 0;
 
-	template<InputRange R, OutputIterator<iter_reference_t<iterator_t<R>>> O>
-	constexpr tagged_pair<tag::in(safe_iterator_t<R>), tag::out(O)>
-	copy(R&& range, O out) {
-		return ::copy(__stl2::begin(range), __stl2::end(range), __stl2::move(out));
-	}
+		int_type overflow(int_type c) override {
+			++overflows;
+			if (traits_type::eq_int_type(c, traits_type::eof())) {
+				return traits_type::not_eof(c);
+			}
+			if (str.size() == limit) {
+				return traits_type::eof();
+			}
+			str += traits_type::to_char_type(c);
+			return c;
+		}
+		std::streamsize xsputn(const char* s, std::streamsize n) override {
+			++xsputns;
+			auto const k = std::min(static_cast<std::size_t>(n), limit - str.size());
+			str.append(s, k);
+			return static_cast<std::streamsize>(k);
+		}
+	};
 }
 
 int main() {
@@ -45,10 +59,42 @@ int main() {
 		static const char hw[] = "Hello, world!";
 		auto hw_range = subrange(__stl2::begin(hw), __stl2::end(hw) - 1);
 		std::ostringstream os;
-		auto r = ::copy(hw_range, I{os});
+		auto r = __stl2::copy(hw_range, I{os});
 		CHECK(r.out() != default_sentinel{});
 		CHECK_EQUAL(os.str(), hw_range);
 	}
 
+	static_assert(ext::SegmentedOutputIterator<I, char>);
+	static_assert(!ext::SegmentedOutputIterator<I, int>);
+	{
+		// copy hands a contiguous range to the streambuf in one sputn.
+		std::string const s(1000, 'x');
+		counting_buf buf;
+		auto r = __stl2::copy(s, I{&buf});
+		CHECK(!r.out().failed());
+		CHECK(r.in() == s.end());
+		CHECK(buf.str == s);
+		CHECK(buf.xsputns == 1);
+		CHECK(buf.overflows == 0);
+
+		__stl2::copy(s.begin(), s.begin(), I{&buf});
+		CHECK(buf.xsputns == 1);
+	}
+	{
+		// A short write fails the iterator, as a failed sputc does.
+		std::string const s(100, 'y');
+		counting_buf buf;
+		buf.limit = 10;
+		auto r = __stl2::copy(s, I{&buf});
+		CHECK(r.out().failed());
+		CHECK(r.out() == default_sentinel{});
+		CHECK(buf.str == s.substr(0, 10));
+
+		auto i = I{&buf};
+		CHECK(!i.failed());
+		i = 'z';
+		CHECK(i.failed());
+	}
+
 	return ::test_result();
 }
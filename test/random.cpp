@@ -0,0 +1,214 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/random.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include "simple_test.hpp"
+#include "test_utils.hpp"
+
+namespace stl2 = __stl2;
+namespace ext = __stl2::ext;
+
+using u64 = std::uint64_t;
+
+static_assert(stl2::UniformRandomNumberGenerator<ext::splitmix64>);
+static_assert(stl2::UniformRandomNumberGenerator<ext::xoshiro256starstar>);
+static_assert(stl2::detail::random::FullWordGenerator<stl2::detail::default_random_engine>);
+static_assert(ext::SeedSequence<ext::seed_seq_fe<>>);
+static_assert(ext::SeedSequence<std::seed_seq>);
+static_assert(!ext::SeedSequence<int>);
+#ifdef __SIZEOF_INT128__
+static_assert(stl2::UniformRandomNumberGenerator<ext::pcg64>);
+static_assert(!ext::SeedSequence<ext::pcg64>);
+#endif
+static_assert(sizeof(ext::xoshiro256starstar) == 32);
+
+// The first outputs given by each engine's reference implementation.
+static_assert([]{ ext::splitmix64 g{0}; return g(); }() == 0xe220a8397b1dcdaf);
+#ifdef __SIZEOF_INT128__
+static_assert([]{ ext::pcg64 g{42, 54}; return g(); }() == 0x86b1da1d72062b68);
+#endif
+
+// The portable 64x64-bit multiply agrees with the 128-bit one.
+constexpr bool mul64_agrees(u64 a, u64 b) {
+	auto const x = stl2::detail::random::mul64_halves(a, b);
+	auto const y = stl2::detail::random::mul64(a, b);
+	return x.hi == y.hi && x.lo == y.lo;
+}
+static_assert(stl2::detail::random::mul64_halves(~u64{0}, ~u64{0}).hi == ~u64{0} - 1);
+static_assert(stl2::detail::random::mul64_halves(~u64{0}, ~u64{0}).lo == 1);
+static_assert(stl2::detail::random::mul64_halves(u64{1} << 32, u64{1} << 32).hi == 1);
+static_assert(stl2::detail::random::mul64_halves(u64{1} << 32, u64{1} << 32).lo == 0);
+static_assert(mul64_agrees(0xffffffff, 0xffffffff));
+static_assert(mul64_agrees(0x9e3779b97f4a7c15, 0xbf58476d1ce4e5b9));
+
+template<class G>
+void check_discard(G g) {
+	auto h = g;
+	for (int i = 0; i < 1000; ++i) {
+		g();
+	}
+	CHECK(g != h);
+	h.discard(1000);
+	CHECK(g == h);
+	CHECK(g() == h());
+}
+
+int main() {
+	{
+		ext::xoshiro256starstar g{std::array<u64, 4>{{1, 2, 3, 4}}};
+		CHECK(g() == u64{11520});
+		CHECK(g() == u64{0});
+		CHECK(g() == u64{1509978240});
+		CHECK(g() == u64{1215971899390074240});
+
+#ifdef __SIZEOF_INT128__
+		ext::pcg64 p{42, 54};
+		CHECK(p() == u64{0x86b1da1d72062b68});
+		CHECK(p() == u64{0x1304aa46c9853d39});
+		CHECK(p() == u64{0xa3670e9e0dd50358});
+#endif
+	}
+
+	check_discard(ext::splitmix64{});
+	check_discard(ext::xoshiro256starstar{});
+#ifdef __SIZEOF_INT128__
+	check_discard(ext::pcg64{});
+	check_discard(ext::pcg64{7, 9});
+#endif
+
+	{
+		// jump is deterministic and moves to another stream.
+		ext::xoshiro256starstar a{42}, b{42};
+		a.jump();
+		b.jump();
+		CHECK(a == b);
+		CHECK(a != ext::xoshiro256starstar{42});
+		// An all-zero state would be stuck.
+		ext::xoshiro256starstar z{std::array<u64, 4>{}};
+		CHECK(z() != z());
+	}
+
+	{
+		// param reproduces the sequence, even after folding long input.
+		std::vector<int> input(12);
+		for (int i = 0; i < 12; ++i) {
+			input[i] = i * 31 + 1;
+		}
+		ext::seed_seq_fe<> q(input.begin(), input.end());
+		CHECK(q.size() == 8u);
+		std::array<std::uint32_t, 8> p;
+		q.param(p.begin());
+		ext::seed_seq_fe<> r(p.begin(), p.end());
+		std::array<std::uint32_t, 16> x, y;
+		q.generate(x.begin(), x.end());
+		r.generate(y.begin(), y.end());
+		CHECK(x == y);
+
+		// Every input word affects the output.
+		input[11] ^= 1;
+		ext::seed_seq_fe<> s(input.begin(), input.end());
+		s.generate(y.begin(), y.end());
+		CHECK(x != y);
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			CHECK(x[i] != y[i]);
+		}
+	}
+
+	{
+		// Engines seed from any SeedSequence, deterministically.
+		ext::seed_seq_fe<4> q{1u, 2u, 3u};
+		ext::xoshiro256starstar a{q}, b{q};
+		CHECK(a == b);
+#ifdef __SIZEOF_INT128__
+		ext::pcg64 c{q}, d{q};
+		CHECK(c == d);
+#endif
+		std::seed_seq sq{1, 2, 3};
+		ext::splitmix64 e{sq}, f{sq};
+		CHECK(e == f);
+		ext::seed_seq_fe<4> q2{1u, 2u, 4u};
+		CHECK(a != ext::xoshiro256starstar{q2});
+		std::mt19937_64 mt{q};
+		(void)mt();
+	}
+
+	{
+		// Each thread has its own freshly seeded default engine.
+		auto& g = stl2::detail::get_random_engine();
+		CHECK(&g == &stl2::detail::get_random_engine());
+		u64 here = g(), there = 0;
+		std::thread t{[&]{ there = stl2::detail::get_random_engine()(); }};
+		t.join();
+		CHECK(here != there);
+	}
+
+	{
+		// Merged shard reservoirs sample the whole stream uniformly.
+		constexpr int trials = 20000;
+		std::array<int, 12> hits{};
+		ext::xoshiro256starstar g{3};
+		for (int t = 0; t < trials; ++t) {
+			ext::weighted_reservoir<int> a{2}, b{2};
+			for (int i = 0; i < 12; ++i) {
+				(i < 4 ? a : b).push(i, g);
+			}
+			a.merge(std::move(b));
+			CHECK(a.size() == 2);
+			auto items = std::move(a).items();
+			CHECK(items[0] != items[1]);
+			for (auto i : items) {
+				++hits[i];
+			}
+		}
+		for (auto h : hits) {
+			CHECK(std::abs(h - trials / 6) < trials / 60);
+		}
+	}
+
+	{
+		// An item of weight 3 beats one of weight 1 three times in four.
+		constexpr int trials = 20000;
+		int heavy = 0;
+		ext::xoshiro256starstar g{5};
+		for (int t = 0; t < trials; ++t) {
+			ext::weighted_reservoir<int> r{1};
+			CHECK(!r.push(0, 0.0, g));
+			r.push(1, 1.0, g);
+			r.push(3, 3.0, g);
+			heavy += r.items()[0] == 3;
+		}
+		CHECK(std::abs(heavy - trials * 3 / 4) < trials / 50);
+	}
+
+	{
+		// Passed-over items draw no random numbers.
+		counting_engine g;
+		ext::weighted_reservoir<int> r{8};
+		for (int i = 0; i < 1000000; ++i) {
+			r.push(i, g);
+		}
+		CHECK(r.size() == 8);
+		CHECK(g.calls < 1000);
+		ext::weighted_reservoir<int> none{0};
+		CHECK(!none.push(1, g));
+		CHECK(none.empty());
+	}
+
+	return ::test_result();
+}
@@ -11,8 +11,10 @@
 #define RANGES_TEST_UTILS_HPP
 
 #include <stl2/iterator.hpp>
+#include <stl2/detail/random/engine.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <initializer_list>
 #include "./test_iterators.hpp"
 #include "./simple_test.hpp"
@@ -29,6 +31,17 @@ T & as_lvalue(T && t)
 	return t;
 }
 
+// A random number engine that counts the numbers drawn from it.
+struct counting_engine
+{
+	using result_type = std::uint64_t;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return ~result_type{0}; }
+	__stl2::ext::splitmix64 g{42};
+	long calls = 0;
+	result_type operator()() { ++calls; return g(); }
+};
+
 template<typename T>
 struct checker
 {
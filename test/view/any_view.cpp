@@ -0,0 +1,175 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/any.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/transform.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/for_each.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/detail/span.hpp>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+namespace view = ranges::view;
+
+using ints = ranges::ext::any_input_view<int>;
+
+// Erased behind a function boundary, as at a plugin interface.
+ints evens(int n) {
+	return view::iota(0) | view::filter([](int i) { return i % 2 == 0; }) | view::take(n);
+}
+
+int main() {
+	static_assert(ranges::View<ints>);
+	static_assert(ranges::InputRange<ints>);
+	static_assert(!ranges::ForwardRange<ints>);
+
+	{
+		ints v = evens(5);
+		CHECK_EQUAL(v, {0, 2, 4, 6, 8});
+	}
+
+	{
+		std::vector<int> vec{1, 2, 3};
+		ints v = vec;
+		ints w = v;
+		CHECK_EQUAL(w, {1, 2, 3});
+		w = view::transform(vec, [](int i) { return i * 10; });
+		CHECK_EQUAL(w, {10, 20, 30});
+		v = std::move(w);
+		CHECK_EQUAL(v, {10, 20, 30});
+	}
+
+	{
+		ints v;
+		CHECK(v.begin() == v.end());
+	}
+
+	{
+		std::istringstream sin{"now is the time"};
+		ranges::ext::any_input_view<std::string, 16, false> words =
+			ranges::subrange(
+				std::istream_iterator<std::string>{sin}, std::istream_iterator<std::string>{});
+		std::vector<std::string> out;
+		for (auto&& w : words) {
+			out.push_back(w);
+		}
+		CHECK(out == std::vector<std::string>{"now", "is", "the", "time"});
+	}
+
+	{
+		// Forward views are multipass, and copies of their iterators are
+		// independent even when the erased iterator is on the heap.
+		using fwd = ranges::ext::any_view<int, ranges::forward_iterator_tag>;
+		static_assert(ranges::ForwardRange<fwd>);
+		static_assert(!ranges::BidirectionalRange<fwd>);
+		std::vector<int> vec{1, 2, 3, 4, 5, 6};
+		fwd v = view::filter(vec, [](int i) { return i % 2 != 0; });
+		auto i = v.begin();
+		auto j = i;
+		++i;
+		CHECK(*i == 3);
+		CHECK(*j == 1);
+		CHECK(i != j);
+		CHECK(++j == i);
+		CHECK_EQUAL(v, {1, 3, 5});
+		CHECK_EQUAL(v, {1, 3, 5});
+	}
+
+	{
+		// next_chunk fills a prefix of the buffer, and is empty at the end.
+		ints v = view::iota(0, 10);
+		auto i = v.begin();
+		int buf[4];
+		auto c = i.next_chunk(ranges::ext::span<int>{buf});
+		CHECK(c.size() == 4);
+		CHECK(c.data() == buf);
+		CHECK(buf[0] == 0);
+		CHECK(buf[3] == 3);
+		CHECK(*i == 4);
+		CHECK(i.next_chunk(ranges::ext::span<int>{buf}).size() == 4);
+		c = i.next_chunk(ranges::ext::span<int>{buf});
+		CHECK(c.size() == 2);
+		CHECK(buf[1] == 9);
+		CHECK(i == v.end());
+		CHECK(i.next_chunk(ranges::ext::span<int>{buf}).empty());
+	}
+
+	{
+		// The algorithms that take chunks see every element, across many
+		// chunks.
+		static_assert(ranges::ext::ChunkedIterator<ranges::iterator_t<ints>>);
+		constexpr int n = 10000;
+		std::vector<int> out;
+		ints all = view::iota(0, n);
+		auto r = ranges::copy(all, ranges::back_inserter(out));
+		CHECK(r.in() == ranges::default_sentinel{});
+		CHECK(static_cast<int>(out.size()) == n);
+		CHECK(out.front() == 0);
+		CHECK(out.back() == n - 1);
+
+		auto threes = view::transform(view::iota(0, n), [](int i) { return i % 3; });
+		CHECK(ranges::count(ints{threes}, 0) == (n + 2) / 3);
+		CHECK(ranges::count(ints{threes}, 1, [](int i) { return i + 1; }) == (n + 2) / 3);
+
+		long sum = 0;
+		ranges::for_each(ints{view::iota(0, n)}, [&](int i) { sum += i; });
+		CHECK(sum == long{n} * (n - 1) / 2);
+
+		// for_each on references mutates the elements, not copies.
+		std::vector<int> vec(n, 1);
+		ranges::ext::any_view<int&> refs = vec;
+		ranges::for_each(refs, [](int& i) { i = 2; });
+		CHECK(ranges::count(vec, 2) == n);
+		CHECK(ranges::count(refs, 2) == n);
+	}
+
+	{
+		// Values that can't be copied into a chunk, or are too big to be
+		// worth it, are visited one at a time.
+		std::vector<std::unique_ptr<int>> ps;
+		for (int i = 0; i < 5; ++i) {
+			ps.push_back(std::make_unique<int>(i));
+		}
+		using owners = ranges::ext::any_view<std::unique_ptr<int>&>;
+		static_assert(!ranges::ext::ChunkedIterator<ranges::iterator_t<owners>>);
+		int sum = 0;
+		ranges::for_each(owners{ps}, [&](auto& p) { sum += *p; });
+		CHECK(sum == 10);
+
+		struct big { char bytes[1024]; };
+		using bigs = ranges::ext::any_view<const big&>;
+		using I = ranges::iterator_t<bigs>;
+		static_assert(ranges::ext::ChunkedIterator<I>);
+		static_assert(!ranges::detail::chunked::Chunkable<I, ranges::default_sentinel>);
+		std::vector<big> bv(3);
+		for (int i = 0; i < 3; ++i) {
+			bv[i].bytes[0] = static_cast<char>(i);
+		}
+		std::vector<big> out;
+		ranges::copy(bigs{bv}, ranges::back_inserter(out));
+		CHECK(out.size() == 3u);
+		CHECK(out[2].bytes[0] == 2);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,108 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/cache1.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/istream.hpp>
+#include <stl2/view/transform.hpp>
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::cache1;
+}
+
+int main() {
+	std::vector<int> v{1, 2, 3, 4, 5, 6};
+	{
+		int calls = 0;
+		auto square = [&calls](int i) { ++calls; return i * i; };
+		auto big = [](int i) { return i > 10; };
+
+		// Without the cache, filter reads each element it accepts twice:
+		// once for the predicate, once for the consumer.
+		std::vector<int> out;
+		for (int i : v | view::transform(square) | view::filter(big)) {
+			out.push_back(i);
+		}
+		CHECK(out == std::vector<int>{16, 25, 36});
+		CHECK(calls == 9);
+
+		calls = 0;
+		out.clear();
+		auto rng = v | view::transform(square) | view::cache1 | view::filter(big);
+		for (int i : rng) {
+			out.push_back(i);
+		}
+		CHECK(out == std::vector<int>{16, 25, 36});
+		CHECK(calls == 6);
+	}
+	{
+		auto rng = v | view::cache1;
+		using R = decltype(rng);
+		using I = ranges::iterator_t<R>;
+		static_assert(ranges::View<R>);
+		static_assert(ranges::InputRange<R>);
+		static_assert(!ranges::ForwardRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::Same<ranges::iter_reference_t<I>, int&>);
+		static_assert(ranges::Same<ranges::iter_rvalue_reference_t<I>, int&&>);
+		CHECK(ranges::size(rng) == 6u);
+
+		// The cache holds the address of an lvalue element, so writes
+		// reach the base.
+		auto i = ranges::begin(rng);
+		CHECK(*i == 1);
+		CHECK(&*i == &v[0]);
+		*i = 42;
+		CHECK(*i == 42);
+		CHECK(v[0] == 42);
+		++i;
+		CHECK(*i == 2);
+		v[0] = 1;
+
+		// Copies of the view don't share the cache.
+		auto copy = rng;
+		CHECK(*ranges::begin(copy) == 1);
+	}
+	{
+		// Elements are moved out of the cache.
+		std::vector<int> w{1, 2};
+		auto rng = w | view::transform([](int x) { return std::make_unique<int>(x); }) | view::cache1;
+		using I = ranges::iterator_t<decltype(rng)>;
+		static_assert(ranges::Same<ranges::iter_reference_t<I>, std::unique_ptr<int>&>);
+		auto i = ranges::begin(rng);
+		std::unique_ptr<int> moved = ranges::iter_move(i);
+		CHECK(*moved == 1);
+		CHECK(*i == nullptr);
+		++i;
+		CHECK(**i == 2);
+		++i;
+		CHECK(i == ranges::end(rng));
+	}
+	{
+		std::istringstream sin{"1 2 3 4"};
+		auto rng = ranges::ext::istream_view<int>{sin} | view::cache1 |
+			view::filter([](int i) { return i % 2 == 0; });
+		std::vector<int> out;
+		for (int i : rng) {
+			out.push_back(i);
+		}
+		CHECK(out == std::vector<int>{2, 4});
+	}
+
+	return ::test_result();
+}
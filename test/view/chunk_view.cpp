@@ -0,0 +1,120 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/chunk.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/transform.hpp>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::chunk;
+}
+
+// The blocks of r, each as a vector.
+template<class R>
+std::vector<std::vector<int>> blocks(R&& r) {
+	std::vector<std::vector<int>> out;
+	for (auto&& b : r) {
+		out.emplace_back();
+		for (auto&& x : b) {
+			out.back().push_back(x);
+		}
+	}
+	return out;
+}
+
+int main() {
+	using VV = std::vector<std::vector<int>>;
+	std::vector<int> v(10);
+	std::iota(v.begin(), v.end(), 0);
+	{
+		auto rng = v | view::chunk(3);
+		using R = decltype(rng);
+		static_assert(ranges::View<R>);
+		static_assert(ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		// The blocks of a contiguous range are spans over it.
+		using B = ranges::iter_value_t<ranges::iterator_t<R>>;
+		static_assert(ranges::Same<B, ranges::ext::span<int>>);
+		static_assert(ranges::ContiguousRange<B>);
+
+		CHECK(rng.chunk_size() == 3);
+		CHECK(ranges::size(rng) == 4u);
+		CHECK(blocks(rng) == VV{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9}});
+
+		auto const first = ranges::begin(rng);
+		auto const last = ranges::end(rng);
+		CHECK((last - first) == 4);
+		CHECK(first[1].data() == v.data() + 3);
+		CHECK(first[3].size() == 1);
+		CHECK((*(last - 1)).data() == v.data() + 9);
+		auto i = last;
+		--i;
+		CHECK((*i).size() == 1);
+		--i;
+		CHECK((*i)[0] == 6);
+		CHECK((i - first) == 2);
+
+		// Writes through a block reach the base.
+		for (auto b : rng) {
+			b[0] = -b[0];
+		}
+		CHECK(v == std::vector<int>{0, 1, 2, -3, 4, 5, -6, 7, 8, -9});
+		std::iota(v.begin(), v.end(), 0);
+	}
+	{
+		CHECK(blocks(v | view::chunk(5)) == VV{{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}});
+		CHECK(ranges::size(v | view::chunk(5)) == 2u);
+		CHECK(blocks(v | view::chunk(20)) == VV{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}});
+		std::vector<int> e;
+		CHECK(ranges::empty(e | view::chunk(4)));
+
+		auto const& cv = v;
+		using CB = ranges::iter_value_t<ranges::iterator_t<decltype(cv | view::chunk(2))>>;
+		static_assert(ranges::Same<CB, ranges::ext::span<const int>>);
+	}
+	{
+		// Other bases get subranges.
+		std::list<int> l(v.begin(), v.end());
+		auto rng = l | view::chunk(4);
+		using R = decltype(rng);
+		static_assert(ranges::BidirectionalRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		CHECK(blocks(rng) == VV{{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9}});
+		auto i = ranges::end(rng);
+		--i;
+		CHECK(*ranges::begin(*i) == 8);
+
+		std::forward_list<int> fl(v.begin(), v.end());
+		CHECK(blocks(fl | view::chunk(6)) == VV{{0, 1, 2, 3, 4, 5}, {6, 7, 8, 9}});
+
+		auto t = v | view::transform([](int i) { return i * i; }) | view::chunk(4);
+		static_assert(ranges::RandomAccessRange<decltype(t)>);
+		CHECK(blocks(t) == VV{{0, 1, 4, 9}, {16, 25, 36, 49}, {64, 81}});
+	}
+	{
+		auto rng = view::iota(0) | view::chunk(2) | view::take(3);
+		CHECK(blocks(rng) == VV{{0, 1}, {2, 3}, {4, 5}});
+	}
+
+	return ::test_result();
+}
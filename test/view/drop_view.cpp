@@ -89,9 +89,10 @@ int main()
 		// consolation for the above not being possible
 		auto rng = view::iota(10) | view::drop(10) | view::take(10);
 		static_assert(ranges::View<decltype(rng)>);
-		static_assert(!ranges::SizedRange<decltype(rng)>);
+		static_assert(ranges::SizedRange<decltype(rng)>);
 		// static_assert(!ranges::is_infinite<decltype(rng5)>::value, "");
 		CHECK_EQUAL(rng, {20, 21, 22, 23, 24, 25, 26, 27, 28, 29});
+		CHECK(ranges::size(rng) == 10u);
 	}
 
 	{
@@ -130,5 +130,15 @@ int main() {
 		CHECK(sum == 4);
 	}
 
+	{
+		// A non-common base has a sentinel.
+		auto rng = view::iota(0) | view::filter(is_even{});
+		auto i = ranges::begin(rng);
+		auto const e = ranges::end(rng);
+		static_assert(!ranges::Same<decltype(i), decltype(e)>);
+		CHECK(i != e);
+		CHECK(*++i == 2);
+	}
+
 	return test_result();
 }
@@ -0,0 +1,243 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/range/for_each_while.hpp>
+#include <stl2/detail/algorithm/all_of.hpp>
+#include <stl2/detail/algorithm/any_of.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/for_each.hpp>
+#include <stl2/detail/algorithm/none_of.hpp>
+#include <stl2/view/common.hpp>
+#include <stl2/view/drop.hpp>
+#include <stl2/view/drop_while.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/indirect.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/join.hpp>
+#include <stl2/view/move.hpp>
+#include <stl2/view/ref.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/take_exactly.hpp>
+#include <stl2/view/take_while.hpp>
+#include <stl2/view/transform.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+namespace view = ranges::view;
+
+template<class R>
+concept bool customized = ranges::__for_each_while::customized<R>;
+
+// The elements of r, as for_each_while hands them out, up to and
+// including the one at which the sink says stop.
+template<class R>
+std::vector<int> collect(R&& r, int stop = -1, bool* done = nullptr) {
+	std::vector<int> out;
+	bool const d = ranges::ext::for_each_while(r, [&](auto&& x) {
+		out.push_back(x);
+		return static_cast<int>(out.size()) != stop;
+	});
+	if (done) {
+		*done = d;
+	}
+	return out;
+}
+
+// Whether for_each_while agrees with iteration over r, and stops
+// where it is told to at every element.
+template<class R>
+bool agrees(R&& r) {
+	std::vector<int> expected;
+	for (auto&& x : r) {
+		expected.push_back(x);
+	}
+	bool done = false;
+	if (collect(r, -1, &done) != expected || !done) {
+		return false;
+	}
+	for (int i = 1; i <= static_cast<int>(expected.size()); ++i) {
+		auto const prefix = collect(r, i, &done);
+		if (done || !ranges::equal(prefix, ranges::subrange(expected.begin(), expected.begin() + i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int main() {
+	std::vector<int> v(20);
+	for (int i = 0; i < 20; ++i) {
+		v[i] = i;
+	}
+	auto const even = [](int i) { return i % 2 == 0; };
+	auto const square = [](int i) { return i * i; };
+	auto const small = [](int i) { return i < 7; };
+
+	{
+		auto t = v | view::transform(square);
+		auto f = v | view::filter(even);
+		auto tw = v | view::ext::take_while(small);
+		auto dw = v | view::ext::drop_while(small);
+		auto tk = v | view::take(5);
+		auto te = view::ext::take_exactly(v, 5);
+		auto d = v | view::ext::drop(15);
+		// The adaptors that do work per element customize it...
+		static_assert(customized<decltype(t)>);
+		static_assert(customized<const decltype(t)>);
+		static_assert(customized<decltype(f)>);
+		static_assert(customized<decltype(tw)>);
+		static_assert(customized<decltype(dw)>);
+		// ...and those that pass elements along do only when their base does.
+		static_assert(!customized<decltype(view::all(v))>);
+		static_assert(!customized<decltype(tk)>);
+		static_assert(!customized<const decltype(tk)>);
+		static_assert(!customized<decltype(te)>);
+		static_assert(!customized<decltype(d)>);
+		static_assert(!customized<decltype(v | view::common)>);
+		static_assert(!customized<decltype(view::move(v))>);
+		static_assert(customized<decltype(f | view::take(5))>);
+		static_assert(customized<decltype(ranges::ext::ref_view{f})>);
+
+		// The algorithms use it only where the iterators have no fast path.
+		static_assert(ranges::detail::InternallyIterable<decltype(f)>);
+		static_assert(ranges::detail::InternallyIterable<decltype(tw)>);
+		static_assert(ranges::detail::InternallyIterable<decltype(f | view::take(5))>);
+		static_assert(!ranges::detail::InternallyIterable<decltype(t)>);
+		static_assert(!ranges::detail::InternallyIterable<std::vector<int>&>);
+		static_assert(!ranges::detail::InternallyIterable<decltype(view::all(v))>);
+		static_assert(!ranges::detail::InternallyIterable<decltype(tk)>);
+		CHECK(agrees(t));
+		CHECK(agrees(f));
+		CHECK(agrees(tw));
+		CHECK(agrees(dw));
+		CHECK(agrees(tk));
+		CHECK(agrees(te));
+		CHECK(agrees(d));
+		CHECK(agrees(v | view::ext::drop(25)));
+		CHECK(agrees(v | view::take(0)));
+		CHECK(agrees(v | view::take(30)));
+		CHECK(agrees(ranges::ext::take_exactly_view{v, 0}));
+		CHECK(agrees(v | view::ext::take_while([](int) { return false; })));
+		CHECK(agrees(v | view::ext::drop_while([](int) { return true; })));
+	}
+	{
+		// A long pipeline runs fused, and reads no further than it must.
+		int calls = 0;
+		auto const counted = [&](int i) { ++calls; return i; };
+		auto p = view::iota(0) | view::transform(counted) | view::filter(even) |
+			view::transform(square) | view::ext::take_while([](int i) { return i < 1000; }) |
+			view::take(5);
+		CHECK(collect(p) == std::vector<int>{0, 4, 16, 36, 64});
+		CHECK(calls == 9);
+
+		calls = 0;
+		CHECK(collect(p, 2) == std::vector<int>{0, 4});
+		CHECK(calls == 3);
+		CHECK(agrees(p));
+	}
+	{
+		// Through a ref_view or common_view to a fused base.
+		auto f = v | view::filter(even);
+		CHECK(agrees(ranges::ext::ref_view{f}));
+		auto c = view::iota(0) | view::take(6) | view::common;
+		CHECK(agrees(c));
+		CHECK(ranges::count_if(c, even) == 3);
+	}
+	{
+		// join of prvalue inner ranges, which its iterators can only
+		// visit by caching each in turn.
+		auto rows = view::iota(0, 4) | view::transform([](int i) {
+			return view::iota(0, i);
+		});
+		auto j = rows | view::join;
+		CHECK(collect(j) == std::vector<int>{0, 0, 1, 0, 1, 2});
+		CHECK(agrees(j));
+
+		std::vector<std::vector<int>> vv{{1, 2}, {}, {3}, {4, 5, 6}};
+		auto jt = vv | view::join | view::transform(square);
+		CHECK(agrees(jt));
+		CHECK(agrees(vv | view::join | view::filter(even)));
+	}
+	{
+		std::vector<std::unique_ptr<int>> ps;
+		for (int i = 0; i < 5; ++i) {
+			ps.push_back(std::make_unique<int>(i * 3));
+		}
+		CHECK(agrees(view::ext::indirect(ps)));
+
+		std::vector<std::string> ss{"a", "bb", "ccc"};
+		std::vector<std::string> moved;
+		ranges::ext::for_each_while(view::move(ss), [&](auto&& s) {
+			static_assert(ranges::Same<decltype(s), std::string&&>);
+			moved.push_back(std::move(s));
+			return true;
+		});
+		CHECK(moved == std::vector<std::string>{"a", "bb", "ccc"});
+		CHECK(ss[2].empty());
+	}
+	{
+		// The algorithms.
+		auto p = v | view::filter(even) | view::transform(square);
+		CHECK(ranges::count_if(p, [](int i) { return i > 50; }) == 6);
+		CHECK(ranges::count(p, 36) == 1);
+		CHECK(ranges::count(p, 5) == 0);
+		CHECK(ranges::any_of(p, [](int i) { return i == 64; }));
+		CHECK(!ranges::any_of(p, [](int i) { return i == 65; }));
+		CHECK(ranges::all_of(p, even));
+		CHECK(!ranges::all_of(p, small));
+		CHECK(ranges::none_of(p, [](int i) { return i < 0; }));
+		CHECK(!ranges::none_of(p, small));
+
+		int sum = 0;
+		auto const r = ranges::for_each(p, [&](int i) { sum += i; });
+		CHECK(sum == 1140);
+		CHECK(r.in() == p.end());
+
+		std::vector<int> out(10);
+		auto const c = ranges::copy(p, out.begin());
+		CHECK(c.in() == p.end());
+		CHECK(c.out() == out.end());
+		CHECK(out == std::vector<int>{0, 4, 16, 36, 64, 100, 144, 196, 256, 324});
+
+		// copy and count of a vector through ref_view or take_view still
+		// reach the memmove and vectorized paths.
+		auto all = view::all(v);
+		auto tk = v | view::take(5);
+		using A = decltype(all);
+		using T = decltype(tk);
+		static_assert(ranges::CommonRange<A> && ranges::CommonRange<T>);
+		static_assert(ranges::detail::bitwise::Assignable<ranges::iterator_t<A>, int*>);
+		static_assert(ranges::detail::bitwise::Assignable<ranges::iterator_t<T>, int*>);
+		static_assert(ranges::detail::simd::Searchable<ranges::iterator_t<A>,
+			ranges::sentinel_t<A>, int, ranges::identity>);
+		static_assert(ranges::detail::simd::Searchable<ranges::iterator_t<T>,
+			ranges::sentinel_t<T>, int, ranges::identity>);
+		int buf[20] = {};
+		CHECK(ranges::copy(all, buf).out() == buf + 20);
+		CHECK(ranges::equal(buf, v));
+		CHECK(ranges::copy(tk, buf).out() == buf + 5);
+		CHECK(ranges::count(all, 7) == 1);
+		CHECK(ranges::count(tk, 7) == 0);
+
+		// Projections see the elements too.
+		auto t = v | view::take(4);
+		CHECK(ranges::count_if(t, even, square) == 2);
+		CHECK(ranges::count(t, 9, square) == 1);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,132 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/istream.hpp>
+#include <clocale>
+#include <cstdlib>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+namespace extract = ranges::detail::extract;
+
+static_assert(ranges::detail::StreamedNumber<int>);
+static_assert(ranges::detail::StreamedNumber<unsigned long long>);
+static_assert(ranges::detail::StreamedNumber<double>);
+static_assert(!ranges::detail::StreamedNumber<char>);
+static_assert(!ranges::detail::StreamedNumber<bool>);
+
+// Fast extraction stores what operator>> stores, and leaves the stream
+// in the same state, at the same position.
+template<class T>
+void check_same(const char* text, std::ios_base::fmtflags flags = std::ios_base::dec | std::ios_base::skipws) {
+	std::istringstream a{text}, b{text};
+	a.flags(flags);
+	b.flags(flags);
+	T x{7}, y{7};
+	a >> x;
+	extract::extract(b, y);
+	CHECK(x == y);
+	CHECK(a.rdstate() == b.rdstate());
+	a.clear();
+	b.clear();
+	CHECK(a.tellg() == b.tellg());
+}
+
+template<class T>
+void check_all(std::vector<const char*> const& texts) {
+	for (auto text : texts) {
+		check_same<T>(text);
+		check_same<T>(text, std::ios_base::dec);
+	}
+}
+
+int main() {
+	std::vector<const char*> const ints = {
+		"0", "42", "  -17 ", "+5", "\t\n 123abc", "", "   ", "-", "+", "x1",
+		"2147483647", "2147483648", "-2147483648", "-2147483649",
+		"99999999999999999999", "007", "1e5", "12 34", "-0"
+	};
+	check_all<int>(ints);
+	check_all<short>(ints);
+	check_all<long long>(ints);
+	check_all<unsigned>(ints);
+	check_all<unsigned long long>(ints);
+
+	std::vector<const char*> const floats = {
+		"0", "3.25", " -1.5e3 ", "+.5", "5.", ".", "-.", "1e", "1e+", "2E-3x",
+		"1e400", "-1e400", "1e-400", "0x1p3", "inf", "nan", "12.34.56",
+		"123456789012345678901234567890", "", "  ", "7 8"
+	};
+	check_all<float>(floats);
+	check_all<double>(floats);
+	check_all<long double>(floats);
+
+	{
+		std::istringstream sin{"1 2 3\n-4 5"};
+		std::vector<int> out;
+		for (int i : ranges::ext::istream_view<int>{sin}) {
+			out.push_back(i);
+		}
+		CHECK(out == std::vector<int>{1, 2, 3, -4, 5});
+	}
+
+	{
+		std::istringstream sin{"0.5 1.5 x 2.5"};
+		std::vector<double> out;
+		for (double d : ranges::ext::istream_view<double>{sin}) {
+			out.push_back(d);
+		}
+		CHECK(out == std::vector<double>{0.5, 1.5});
+	}
+
+	{
+		// Other formatting still goes through operator>>.
+		std::istringstream sin{"ff 10"};
+		sin >> std::hex;
+		CHECK(!extract::applies(sin));
+		std::vector<int> out;
+		for (int i : ranges::ext::istream_view<int>{sin}) {
+			out.push_back(i);
+		}
+		CHECK(out == std::vector<int>{255, 16});
+	}
+
+	{
+		// A global C locale with a ',' decimal point doesn't change what a
+		// stream imbued with the classic locale reads, where one is
+		// installed.
+		for (auto name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"}) {
+			if (!std::setlocale(LC_NUMERIC, name)) {
+				continue;
+			}
+			CHECK(std::strtod("1,5", nullptr) == 1.5);
+			std::istringstream sin{"1.5 2.25"};
+			if (extract::applies(sin)) {
+				check_all<float>(floats);
+				check_all<double>(floats);
+				check_all<long double>(floats);
+			}
+			std::vector<double> out;
+			for (double d : ranges::ext::istream_view<double>{sin}) {
+				out.push_back(d);
+			}
+			CHECK(out == std::vector<double>{1.5, 2.25});
+			std::setlocale(LC_NUMERIC, "C");
+			break;
+		}
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,139 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/istreambuf.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+namespace view = ranges::view;
+
+using V = ranges::ext::istreambuf_view<char>;
+static_assert(ranges::View<V>);
+static_assert(ranges::InputRange<V>);
+static_assert(ranges::ext::SegmentedIterator<ranges::iterator_t<V>>);
+
+// Hands out text a few characters at a time, counting the refills.
+class small_buf : public std::streambuf {
+	std::string text_;
+	std::size_t pos_ = 0, size_;
+	char buf_[7];
+public:
+	int underflows = 0;
+
+	explicit small_buf(std::string text, std::size_t size = sizeof(buf_))
+	: text_(std::move(text)), size_(size) {}
+
+	int_type underflow() override {
+		++underflows;
+		if (pos_ == text_.size()) {
+			return traits_type::eof();
+		}
+		auto const n = text_.copy(buf_, size_, pos_);
+		pos_ += n;
+		setg(buf_, buf_, buf_ + n);
+		return traits_type::to_int_type(buf_[0]);
+	}
+};
+
+// Has no get area at all.
+class unbuffered : public std::streambuf {
+	std::string text_;
+	std::size_t pos_ = 0;
+public:
+	explicit unbuffered(std::string text) : text_(std::move(text)) {}
+
+	int_type underflow() override {
+		return pos_ == text_.size() ? traits_type::eof()
+			: traits_type::to_int_type(text_[pos_]);
+	}
+	int_type uflow() override {
+		return pos_ == text_.size() ? traits_type::eof()
+			: traits_type::to_int_type(text_[pos_++]);
+	}
+};
+
+int main() {
+	std::string const text = "the quick brown fox jumps over the lazy dog";
+
+	{
+		std::istringstream sin{text};
+		std::string out;
+		auto v = view::istreambuf(sin);
+		auto r = ranges::copy(v, ranges::back_inserter(out));
+		CHECK(out == text);
+		CHECK(r.in() == ranges::default_sentinel{});
+	}
+
+	{
+		// Segments span the refills of a small buffer.
+		small_buf sb{text};
+		V v{&sb};
+		std::string out;
+		ranges::copy(v, ranges::back_inserter(out));
+		CHECK(out == text);
+		CHECK(sb.underflows == static_cast<int>((text.size() + 6) / 7 + 1));
+	}
+
+	{
+		small_buf sb{text};
+		V v{&sb};
+		auto i = ranges::find(v, 'f');
+		CHECK(*i == 'f');
+		++i;
+		CHECK(*i == 'o');
+		CHECK(ranges::count(i, ranges::default_sentinel{}, 'o') == 3);
+		CHECK(i == ranges::default_sentinel{});
+		CHECK(ranges::find(v, 'x') == ranges::default_sentinel{});
+	}
+
+	{
+		// consume may stop inside a segment.
+		std::istringstream sin{text};
+		V v{sin};
+		auto i = v.begin();
+		auto seg = i.segment();
+		CHECK(seg.size() == static_cast<std::ptrdiff_t>(text.size()));
+		i.consume(4);
+		CHECK(*i == 'q');
+		CHECK(i.segment().size() == seg.size() - 4);
+		i.consume(i.segment().size());
+		CHECK(i == ranges::default_sentinel{});
+		CHECK(i.segment().empty());
+	}
+
+	{
+		// Without a get area, each segment is one character.
+		unbuffered sb{text};
+		V v{&sb};
+		auto i = v.begin();
+		CHECK(i.segment().size() == 1);
+		CHECK(i.segment()[0] == 't');
+		std::string out;
+		ranges::copy(v, ranges::back_inserter(out));
+		CHECK(out == text);
+	}
+
+	{
+		V v;
+		CHECK(v.begin() == v.end());
+		std::istringstream sin{""};
+		CHECK(ranges::count(view::istreambuf(sin), 'a') == 0);
+	}
+
+	return ::test_result();
+}
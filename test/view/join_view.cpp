@@ -13,7 +13,14 @@
 #include <stl2/view/iota.hpp>
 #include <stl2/view/transform.hpp>
 #include <stl2/view/filter.hpp>
+#include <stl2/view/counted.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/detail/algorithm/fill.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/find_if.hpp>
+#include <stl2/detail/algorithm/for_each.hpp>
 #include <stl2/detail/algorithm/transform.hpp>
 #include <stl2/detail/iterator/insert_iterators.hpp>
 #include <memory>
@@ -60,5 +67,67 @@ int main()
 		static_assert(!CommonRange<decltype(rng)>);
 	}
 
+	{
+		// Over lvalue inner ranges, the iterators are hierarchical: the
+		// algorithms below loop over each inner vector in turn.
+		std::vector<std::vector<int>> vv{{}, {0, 1, 2}, {}, {}, {3}, {4, 5, 6, 7}, {}};
+		join_view jv{vv};
+		using I = iterator_t<decltype(jv)>;
+		static_assert(ext::HierarchicalIterator<I>);
+		static_assert(Same<ext::segmented_iterator_traits<I>::local_iterator,
+			std::vector<int>::iterator>);
+
+		std::vector<int> out;
+		auto r = ranges::copy(jv, ranges::back_inserter(out));
+		CHECK(r.in() == jv.end());
+		CHECK_EQUAL(out, {0, 1, 2, 3, 4, 5, 6, 7});
+
+		auto sum = 0;
+		ranges::for_each(jv, [&](int i) { sum += i; });
+		CHECK(sum == 28);
+		CHECK(ranges::count(jv, 4) == 1);
+		CHECK(ranges::count_if(jv, [](int i) { return i % 2 == 0; }) == 4);
+
+		for (int i = 0; i < 8; ++i) {
+			auto const pos = ranges::find(jv, i);
+			CHECK(*pos == i);
+			CHECK(pos == ranges::next(jv.begin(), i));
+			CHECK(ranges::find_if(jv, [=](int j) { return j == i; }) == pos);
+		}
+		CHECK(ranges::find(jv, 42) == jv.end());
+
+		// Subranges that start and end within inner ranges.
+		auto const first = ranges::next(jv.begin(), 2), last = ranges::next(jv.begin(), 6);
+		out.clear();
+		ranges::copy(first, last, ranges::back_inserter(out));
+		CHECK_EQUAL(out, {2, 3, 4, 5});
+		CHECK(ranges::count(first, last, 6) == 0);
+		CHECK(ranges::find(first, last, 6) == last);
+		CHECK(ranges::find(first, last, 3) == ranges::next(first));
+		CHECK(ranges::count(first, first, 2) == 0);
+		CHECK(ranges::find(ranges::next(first), ranges::next(first, 2), 3) == ranges::next(first));
+
+		CHECK(ranges::fill(ranges::next(jv.begin()), last, 9) == last);
+		CHECK_EQUAL(jv, {0, 9, 9, 9, 9, 9, 6, 7});
+
+		// And with a sentinel, for an outer range that isn't common.
+		auto const cv = view::counted(vv.begin(), 5);
+		join_view js{cv};
+		static_assert(!CommonRange<decltype(js)>);
+		CHECK(ranges::count(js, 9) == 3);
+		CHECK(*ranges::find(js, 9) == 9);
+		CHECK(ranges::find(js, 6) == js.end());
+		out.clear();
+		ranges::copy(js, ranges::back_inserter(out));
+		CHECK_EQUAL(out, {0, 9, 9, 9});
+		ranges::fill(js, 1);
+		CHECK_EQUAL(jv, {1, 1, 1, 1, 9, 9, 6, 7});
+
+		std::vector<std::vector<int>> empty{{}, {}};
+		join_view je{empty};
+		CHECK(ranges::find(je, 0) == je.end());
+		CHECK(ranges::count(je, 0) == 0);
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,143 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/mapped_file.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/search.hpp>
+#include <stl2/view/split.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+namespace view = ranges::view;
+
+using V = ranges::ext::mapped_file_view<>;
+static_assert(ranges::View<V>);
+static_assert(ranges::ContiguousRange<V>);
+static_assert(ranges::SizedRange<V>);
+static_assert(ranges::CommonRange<V>);
+static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<V>>, const char&>);
+
+using B = ranges::ext::mapped_file_view<const std::byte>;
+static_assert(ranges::ContiguousRange<B>);
+static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<B>>, const std::byte&>);
+
+using W = ranges::ext::mapped_file_view<char>;
+static_assert(ranges::ContiguousRange<W>);
+static_assert(ranges::OutputRange<W, char>);
+
+// A file in the temporary directory, removed with the object.
+class temp_file {
+	std::string path_;
+public:
+	explicit temp_file(const std::string& contents) {
+		char name[] = "/tmp/stl2_mapped_file_XXXXXX";
+		int const fd = ::mkstemp(name);
+		CHECK(fd >= 0);
+		::close(fd);
+		path_ = name;
+		std::ofstream{path_, std::ios::binary} << contents;
+	}
+	~temp_file() { std::remove(path_.c_str()); }
+
+	const std::string& path() const { return path_; }
+};
+
+std::string read(const std::string& path) {
+	std::ifstream in{path, std::ios::binary};
+	return std::string{std::istreambuf_iterator<char>{in}, {}};
+}
+
+int main() {
+	std::string text;
+	for (int i = 0; i < 10000; ++i) {
+		text += std::to_string(i);
+		text += i % 10 == 9 ? '\n' : ' ';
+	}
+	temp_file const f{text};
+
+	{
+		auto const v = view::mapped_file(f.path());
+		CHECK(v.size() == text.size());
+		CHECK(!v.empty());
+		CHECK(ranges::equal(v, text));
+		CHECK(ranges::count(v, '\n') == 1000);
+		CHECK(*ranges::find(v, '\n') == '\n');
+		CHECK((ranges::find(v, '\n') - v.begin()) == 19);
+
+		static const char needle[] = "9998 9999\n";
+		auto const found = ranges::search(v, ranges::subrange(needle, needle + 10));
+		CHECK(found.end() == v.end());
+		CHECK(found.begin() == v.end() - 10);
+
+		auto lines = v | view::split('\n');
+		auto n = 0;
+		for (auto line : lines) {
+			(void)line;
+			++n;
+		}
+		CHECK(n == 1000);
+
+		// Copies share the mapping, which outlives the original.
+		V copy;
+		CHECK(copy.empty());
+		{
+			auto const tmp = view::mapped_file(f.path().c_str());
+			copy = tmp;
+		}
+		CHECK(ranges::equal(copy, text));
+	}
+	{
+		using A = ranges::ext::map_advice;
+		for (auto advice : {A::normal, A::sequential, A::random, A::willneed}) {
+			for (bool huge : {false, true}) {
+				B const b{f.path(), {advice, huge}};
+				CHECK(b.size() == text.size());
+				CHECK(static_cast<char>(b[5]) == text[5]);
+			}
+		}
+	}
+	{
+		// Writes to a copy-on-write mapping stay out of the file.
+		W w{f.path()};
+		CHECK(ranges::equal(w, text));
+		w[0] = 'X';
+		*(w.end() - 1) = 'Y';
+		CHECK(w[0] == 'X');
+		CHECK(*(w.end() - 1) == 'Y');
+		CHECK(read(f.path()) == text);
+	}
+	{
+		temp_file const empty{""};
+		auto const v = view::mapped_file(empty.path());
+		CHECK(v.empty());
+		CHECK(v.begin() == v.end());
+	}
+	{
+		bool threw = false;
+		try {
+			view::mapped_file("/nonexistent/stl2/mapped_file");
+		} catch (const std::system_error& e) {
+			threw = e.code() == std::errc::no_such_file_or_directory;
+		}
+		CHECK(threw);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,103 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/memoize.hpp>
+#include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/istream.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/transform.hpp>
+#include <sstream>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::memoize;
+}
+
+int main() {
+	{
+		int calls = 0;
+		std::vector<int> v{1, 2, 3, 4, 5, 6};
+		auto rng = v | view::transform([&calls](int i) { ++calls; return i * i; }) | view::memoize;
+		using R = decltype(rng);
+		using I = ranges::iterator_t<R>;
+		static_assert(ranges::View<R>);
+		static_assert(ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(!ranges::CommonRange<R>);
+		static_assert(ranges::Same<ranges::iter_reference_t<I>, const int&>);
+		CHECK(ranges::size(rng) == 6u);
+		CHECK(calls == 0);
+
+		// Reading the fourth element reads those before it, once.
+		auto const first = ranges::begin(rng);
+		CHECK(first[3] == 16);
+		CHECK(calls == 4);
+		CHECK(*first == 1);
+		CHECK(calls == 4);
+
+		// However many passes and dereferences.
+		auto const big = [](int i) { return i > 10; };
+		CHECK(ranges::count_if(rng, big) == 3);
+		CHECK(ranges::count_if(rng | view::filter(big), big) == 3);
+		CHECK_EQUAL(rng, {1, 4, 9, 16, 25, 36});
+		CHECK(calls == 6);
+
+		CHECK((ranges::next(first, 6) == ranges::end(rng)));
+		CHECK((ranges::next(first, 5) != ranges::end(rng)));
+		CHECK((ranges::next(first, 4) - first) == 4);
+
+		// Copies share what has been read.
+		auto copy = rng;
+		CHECK_EQUAL(copy, {1, 4, 9, 16, 25, 36});
+		CHECK(calls == 6);
+	}
+	{
+		// An input range, multi-pass.
+		std::istringstream sin{"1 2 3 4 5"};
+		auto rng = ranges::ext::istream_view<int>{sin} | view::memoize;
+		static_assert(ranges::ForwardRange<decltype(rng)>);
+		CHECK_EQUAL(rng | view::take(2), {1, 2});
+		CHECK_EQUAL(rng, {1, 2, 3, 4, 5});
+		CHECK_EQUAL(rng, {1, 2, 3, 4, 5});
+		CHECK(ranges::distance(rng) == 5);
+	}
+	{
+		// Unbounded, and read no further than needed.
+		int calls = 0;
+		auto rng = view::iota(0) | view::transform([&calls](int i) { ++calls; return i; }) | view::memoize;
+		CHECK_EQUAL(rng | view::take(3), {0, 1, 2});
+		CHECK(calls == 3);
+		CHECK_EQUAL(rng | view::take(3), {0, 1, 2});
+		CHECK(calls == 3);
+	}
+	{
+		std::vector<int> e;
+		auto rng = e | view::memoize;
+		CHECK(ranges::empty(rng));
+		CHECK(ranges::begin(rng) == ranges::end(rng));
+	}
+	{
+		// A default-constructed view is empty.
+		std::vector<int> v{1, 2, 3};
+		decltype(v | view::memoize) rng;
+		CHECK(ranges::begin(rng) == ranges::end(rng));
+		CHECK(ranges::size(rng) == 0u);
+		CHECK(ranges::distance(rng) == 0);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,139 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// The compositions of views whose size is known in O(1), as SizedRanges
+// whose size() agrees with their length; and those whose size is not.
+//
+#include <stl2/view/common.hpp>
+#include <stl2/view/drop.hpp>
+#include <stl2/view/drop_while.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/join.hpp>
+#include <stl2/view/move.hpp>
+#include <stl2/view/repeat.hpp>
+#include <stl2/view/reverse.hpp>
+#include <stl2/view/single.hpp>
+#include <stl2/view/stride.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/take_exactly.hpp>
+#include <stl2/view/take_while.hpp>
+#include <stl2/view/transform.hpp>
+#include <stl2/view/zip.hpp>
+#include <array>
+#include <forward_list>
+#include <list>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::drop;
+	using ranges::view::ext::drop_while;
+	using ranges::view::ext::repeat;
+	using ranges::view::ext::stride;
+	using ranges::view::ext::take_exactly;
+	using ranges::view::ext::take_while;
+	using ranges::view::ext::zip;
+}
+
+// r is sized, and its size is the number of its elements, n.
+template<class R>
+void check_size(R&& r, std::ptrdiff_t n) {
+	static_assert(ranges::SizedRange<R>);
+	CHECK(static_cast<std::ptrdiff_t>(ranges::size(r)) == n);
+	std::ptrdiff_t d = 0;
+	for (auto i = ranges::begin(r); i != ranges::end(r); ++i) {
+		++d;
+	}
+	CHECK(d == n);
+}
+
+int main() {
+	std::vector<int> v{0, 1, 2, 3, 4};
+	std::list<int> l{0, 1, 2, 3, 4};
+	std::forward_list<int> fl{0, 1, 2, 3, 4};
+	auto const even = [](int i) { return i % 2 == 0; };
+	{
+		// take_view over a sized range that isn't random-access counts
+		// down from the smaller of the two sizes.
+		check_size(l | view::take(2), 2);
+		check_size(l | view::take(9), 5);
+		check_size(l | view::take(4) | view::take(2), 2);
+		static_assert(!ranges::SizedRange<decltype(fl | view::take(2))>);
+
+		// Over a range that never ends, the count is the size.
+		auto first = view::iota(0) | view::take(4);
+		static_assert(ranges::RandomAccessRange<decltype(first)>);
+		check_size(first, 4);
+		CHECK((ranges::end(first) - ranges::begin(first)) == 4);
+		check_size(view::repeat(7) | view::take(3), 3);
+		check_size(view::iota(0) | view::take(4) | view::common | view::reverse, 4);
+		static_assert(!ranges::SizedRange<decltype(view::iota(0))>);
+		static_assert(!ranges::SizedRange<decltype(view::repeat(7))>);
+	}
+	{
+		// join_view over inner ranges whose size is part of their type.
+		std::vector<std::array<int, 3>> rows(4);
+		check_size(rows | view::join, 12);
+		std::array<std::array<int, 2>, 3> grid{};
+		check_size(grid | view::join, 6);
+		std::vector<int[4]> arrays(2);
+		check_size(arrays | view::join, 8);
+		std::vector<ranges::single_view<int>> singles(3, ranges::single_view<int>{1});
+		check_size(singles | view::join, 3);
+		std::vector<std::array<int, 0>> empties(3);
+		check_size(empties | view::join, 0);
+
+		std::vector<std::vector<int>> ragged{{1}, {2, 3}};
+		static_assert(!ranges::SizedRange<decltype(ragged | view::join)>);
+		std::list<std::array<int, 3>> list_outer(2);
+		check_size(list_outer | view::join, 6);
+		std::forward_list<std::array<int, 3>> unsized_outer(2);
+		static_assert(!ranges::SizedRange<decltype(unsized_outer)>);
+		static_assert(!ranges::SizedRange<decltype(unsized_outer | view::join)>);
+		CHECK(ranges::distance(unsized_outer | view::join) == 6);
+	}
+	{
+		// common_view, and reverse_view and move_view over it.
+		check_size(l | view::take(2) | view::common, 2);
+		check_size(l | view::take(2) | view::common | view::move, 2);
+		auto rng = v | view::take_exactly(3);
+		static_assert(!ranges::CommonRange<decltype(rng)>);
+		check_size(rng | view::common, 3);
+		check_size(rng | view::common | view::reverse, 3);
+		check_size(rng | view::common | view::move, 3);
+		check_size(l | view::reverse, 5);
+		check_size(l | view::move, 5);
+	}
+	{
+		// Chains of size-preserving adaptors.
+		check_size(l | view::take(4) | view::transform(even) | view::drop(1), 3);
+		check_size(l | view::take(4) | view::stride(3), 2);
+		check_size(view::zip(v, l), 5);
+		check_size(view::zip(l, view::iota(0)), 5);
+		check_size(view::zip(v, view::repeat(1)) | view::take(2), 2);
+		check_size(view::zip(view::repeat(1), v), 5);
+		check_size(view::zip(view::repeat(1), v) | view::reverse, 5);
+	}
+	{
+		// Those whose size isn't known without traversing them.
+		static_assert(!ranges::SizedRange<decltype(v | view::filter(even))>);
+		static_assert(!ranges::SizedRange<decltype(view::take_while(v, even))>);
+		static_assert(!ranges::SizedRange<decltype(view::drop_while(v, even))>);
+		static_assert(!ranges::SizedRange<decltype(v | view::filter(even) | view::take(2))>);
+		static_assert(!ranges::SizedRange<decltype(view::zip(view::iota(0), view::repeat(1)))>);
+	}
+
+	return ::test_result();
+}
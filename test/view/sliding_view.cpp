@@ -0,0 +1,105 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/sliding.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/take.hpp>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::sliding;
+}
+
+// The windows of r, each as a vector.
+template<class R>
+std::vector<std::vector<int>> windows(R&& r) {
+	std::vector<std::vector<int>> out;
+	for (auto&& w : r) {
+		out.emplace_back();
+		for (auto&& x : w) {
+			out.back().push_back(x);
+		}
+	}
+	return out;
+}
+
+int main() {
+	using VV = std::vector<std::vector<int>>;
+	std::vector<int> v(6);
+	std::iota(v.begin(), v.end(), 0);
+	{
+		auto rng = v | view::sliding(3);
+		using R = decltype(rng);
+		static_assert(ranges::View<R>);
+		static_assert(ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		using W = ranges::iter_value_t<ranges::iterator_t<R>>;
+		static_assert(ranges::Same<W, ranges::ext::span<int>>);
+
+		CHECK(rng.window_size() == 3);
+		CHECK(ranges::size(rng) == 4u);
+		CHECK(windows(rng) == VV{{0, 1, 2}, {1, 2, 3}, {2, 3, 4}, {3, 4, 5}});
+
+		auto const first = ranges::begin(rng);
+		auto const last = ranges::end(rng);
+		CHECK((last - first) == 4);
+		CHECK(first[2].data() == v.data() + 2);
+		CHECK(first[2].size() == 3);
+		CHECK((*(last - 1)).data() == v.data() + 3);
+		CHECK((first + 4) == last);
+	}
+	{
+		CHECK(windows(v | view::sliding(1)) == VV{{0}, {1}, {2}, {3}, {4}, {5}});
+		CHECK(windows(v | view::sliding(6)) == VV{{0, 1, 2, 3, 4, 5}});
+		// Too few elements for a single window.
+		auto none = v | view::sliding(7);
+		CHECK(ranges::empty(none));
+		CHECK(ranges::size(none) == 0u);
+		CHECK((ranges::end(none) - ranges::begin(none)) == 0);
+		std::vector<int> e;
+		CHECK(ranges::empty(e | view::sliding(2)));
+	}
+	{
+		std::list<int> l(v.begin(), v.end());
+		auto rng = l | view::sliding(4);
+		using R = decltype(rng);
+		static_assert(ranges::BidirectionalRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		using W = ranges::iter_value_t<ranges::iterator_t<R>>;
+		static_assert(ranges::Same<W, ranges::subrange<std::list<int>::iterator>>);
+		CHECK(windows(rng) == VV{{0, 1, 2, 3}, {1, 2, 3, 4}, {2, 3, 4, 5}});
+		auto i = ranges::end(rng);
+		--i;
+		CHECK(*ranges::begin(*i) == 2);
+		CHECK(ranges::empty(l | view::sliding(7)));
+
+		std::forward_list<int> fl(v.begin(), v.end());
+		auto frng = fl | view::sliding(5);
+		static_assert(!ranges::CommonRange<decltype(frng)>);
+		CHECK(windows(frng) == VV{{0, 1, 2, 3, 4}, {1, 2, 3, 4, 5}});
+	}
+	{
+		auto rng = view::iota(0) | view::sliding(3) | view::take(2);
+		CHECK(windows(rng) == VV{{0, 1, 2}, {1, 2, 3}});
+	}
+
+	return ::test_result();
+}
@@ -11,12 +11,18 @@
 //
 #include <stl2/view/split.hpp>
 #include <stl2/view/empty.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
 #include <stl2/detail/iterator/istreambuf_iterator.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
 #include <list>
 #include <sstream>
+#include <string>
+#include <vector>
 
 namespace ranges = __stl2;
 
@@ -215,5 +221,60 @@ int main() {
 		CHECK(i == sv.end());
 	}
 
+	{
+		// The pieces of a contiguous range are segmented, so copy, count
+		// and find see each as a single span.
+		std::string csv{"a--bb----ccc--c-d"};
+		std::string dashes{"--"};
+		split_view sv{csv, dashes};
+		using Piece = iter_value_t<iterator_t<decltype(sv)>>;
+		static_assert(ext::SegmentedIterator<iterator_t<Piece>>);
+
+		std::vector<std::string> pieces;
+		for (auto piece : sv) {
+			auto const seg = piece.begin().segment();
+			CHECK((seg.empty() || seg.data() >= csv.data()));
+			std::string s;
+			copy(piece, back_inserter(s));
+			pieces.push_back(s);
+		}
+		CHECK(pieces == std::vector<std::string>{"a", "bb", "", "ccc", "c-d"});
+
+		auto i = sv.begin();
+		++i; ++i; ++i;
+		CHECK(count(*i, 'c') == 3);
+		auto const last = *++i;
+		CHECK(count(last, 'c') == 1);
+		CHECK(*find(last, '-') == '-');
+		auto const j = find(last, 'd');
+		CHECK(*j == 'd');
+		CHECK((ranges::next(j) == default_sentinel{}));
+		CHECK((find(last, 'x') == default_sentinel{}));
+
+		// Segments agree with element-wise iteration, also after a partial
+		// traversal.
+		auto k = (*sv.begin()).begin();
+		CHECK(k.segment().size() == 1);
+		++k;
+		CHECK(k.segment().size() == 0);
+		auto m = (*++sv.begin()).begin();
+		++m;
+		CHECK(std::string(m.segment().data(), m.segment().size()) == "b");
+	}
+
+	{
+		// With an empty pattern, each piece is one element.
+		std::string hello{"hello"};
+		split_view sv{hello, view::empty<char>};
+		std::string s;
+		for (auto piece : sv) {
+			auto const seg = piece.begin().segment();
+			CHECK(seg.size() == 1);
+			CHECK(count(piece, 'l') == (seg[0] == 'l'));
+			copy(piece, back_inserter(s));
+		}
+		CHECK(s == hello);
+	}
+
 	return test_result();
 }
@@ -0,0 +1,122 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/stride.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/istream.hpp>
+#include <stl2/view/take.hpp>
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::stride;
+}
+
+// The elements of r, from last to first.
+template<class R>
+std::vector<int> backwards(R& r) {
+	std::vector<int> out;
+	auto const first = ranges::begin(r);
+	for (auto i = ranges::end(r); i != first;) {
+		out.push_back(*--i);
+	}
+	return out;
+}
+
+int main() {
+	std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	{
+		auto rng = v | view::stride(3);
+		using R = decltype(rng);
+		static_assert(ranges::View<R>);
+		static_assert(ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		CHECK(rng.stride() == 3);
+		CHECK(ranges::size(rng) == 4u);
+		CHECK_EQUAL(rng, {0, 3, 6, 9});
+
+		auto const first = ranges::begin(rng);
+		auto const last = ranges::end(rng);
+		CHECK((last - first) == 4);
+		CHECK(first[2] == 6);
+		CHECK(*(first + 3) == 9);
+		CHECK((first + 4) == last);
+		CHECK(*(last - 1) == 9);
+		CHECK(*(last - 4) == 0);
+		CHECK(backwards(rng) == std::vector<int>{9, 6, 3, 0});
+	}
+	{
+		// The last stride overshoots the end, and stepping back from the
+		// end must land on the last element taken.
+		auto rng = v | view::stride(4);
+		CHECK(ranges::size(rng) == 3u);
+		CHECK_EQUAL(rng, {0, 4, 8});
+		auto it = ranges::end(rng);
+		CHECK(*--it == 8);
+		CHECK(*--it == 4);
+		it = ranges::begin(rng);
+		it += 3;
+		CHECK(it == ranges::end(rng));
+		it -= 2;
+		CHECK(*it == 4);
+		CHECK((ranges::end(rng) - it) == 2);
+		CHECK(backwards(rng) == std::vector<int>{8, 4, 0});
+	}
+	{
+		CHECK_EQUAL(v | view::stride(1), {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+		CHECK_EQUAL(v | view::stride(10), {0});
+		CHECK_EQUAL(v | view::stride(25), {0});
+		std::vector<int> e;
+		CHECK(ranges::empty(e | view::stride(2)));
+		CHECK(ranges::size(e | view::stride(2)) == 0u);
+	}
+	{
+		// A list knows its size, so the end still knows how far short of
+		// a whole stride the last one falls.
+		std::list<int> l{0, 1, 2, 3, 4, 5, 6};
+		auto rng = l | view::stride(2);
+		using R = decltype(rng);
+		static_assert(ranges::BidirectionalRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		CHECK_EQUAL(rng, {0, 2, 4, 6});
+		CHECK(backwards(rng) == std::vector<int>{6, 4, 2, 0});
+
+		std::forward_list<int> fl{0, 1, 2, 3, 4, 5, 6};
+		auto frng = fl | view::stride(3);
+		static_assert(ranges::ForwardRange<decltype(frng)>);
+		static_assert(ranges::CommonRange<decltype(frng)>);
+		CHECK_EQUAL(frng, {0, 3, 6});
+	}
+	{
+		auto rng = view::iota(0) | view::stride(5) | view::take(4);
+		CHECK_EQUAL(rng, {0, 5, 10, 15});
+		static_assert(ranges::RandomAccessRange<decltype(view::iota(0) | view::stride(5))>);
+		static_assert(!ranges::CommonRange<decltype(view::iota(0) | view::stride(5))>);
+	}
+	{
+		std::istringstream sin{"0 1 2 3 4 5 6 7"};
+		auto rng = ranges::ext::istream_view<int>{sin} | view::stride(3);
+		static_assert(ranges::InputRange<decltype(rng)>);
+		static_assert(!ranges::ForwardRange<decltype(rng)>);
+		CHECK_EQUAL(rng, {0, 3, 6});
+	}
+
+	return ::test_result();
+}
@@ -41,12 +41,13 @@ int main()
 		auto rng = view::iota(0) | view::take(10);
 		using R = decltype(rng);
 		static_assert(View<R>);
-		static_assert(!SizedRange<R>);
+		static_assert(SizedRange<R>);
 		static_assert(!CommonRange<R>);
 		static_assert(RandomAccessRange<R>);
 		static_assert(!ContiguousRange<R>);
 		static_assert(Range<const R>);
 		CHECK_EQUAL(rng, {0,1,2,3,4,5,6,7,8,9});
+		CHECK(size(rng) == 10u);
 	}
 
 	{
@@ -0,0 +1,211 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+// Abstraction-penalty audit: each view pipeline is timed against the loop
+// it stands for, and the test fails if the pipeline costs noticeably
+// more. Being a measurement, it is registered only for Release builds
+// with STL2_PERF_TESTS, under the "perf" label, and runs serially (see
+// CMakeLists.txt). stl2_bench_view reports the same pairs in detail.
+//
+// Cost is counted in retired user-mode instructions when perf_event_open
+// allows it, which is deterministic enough for a tight bound; otherwise in
+// cycles (rdtsc) or nanoseconds, with a looser bound to absorb noise.
+//
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/take.hpp>
+#include <stl2/view/transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "../simple_test.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace view = __stl2::view;
+
+namespace {
+	class counter {
+	public:
+		counter() {
+#if defined(__linux__)
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.size = sizeof(attr);
+			attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			fd_ = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+			if (fd_ >= 0) {
+				::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+			}
+#endif
+		}
+		~counter() {
+#if defined(__linux__)
+			if (fd_ >= 0) {
+				::close(fd_);
+			}
+#endif
+		}
+		counter(const counter&) = delete;
+		counter& operator=(const counter&) = delete;
+
+		bool exact() const noexcept { return fd_ >= 0; }
+
+		// The cost of one call of f, as the least of several runs.
+		template<class F>
+		std::uint64_t operator()(F f) {
+			auto best = ~std::uint64_t{0};
+			for (int i = 0; i < 101; ++i) {
+				auto const start = read();
+				auto volatile result = f();
+				auto const cost = read() - start;
+				(void)result;
+				best = std::min(best, cost);
+			}
+			return best;
+		}
+
+	private:
+		int fd_ = -1;
+
+		std::uint64_t read() {
+#if defined(__linux__)
+			if (exact()) {
+				std::uint64_t value = 0;
+				if (::read(fd_, &value, sizeof(value)) != sizeof(value)) {
+					value = 0;
+				}
+				return value;
+			}
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+		}
+	};
+
+	constexpr auto even = [](int i) { return (i & 1) == 0; };
+	constexpr auto square = [](int i) { return static_cast<unsigned>(i) * static_cast<unsigned>(i); };
+
+	std::vector<int> data(1 << 14);
+	int n = static_cast<int>(data.size());
+
+	// Each kernel pairs a pipeline with the loop it replaces. They are
+	// out-of-line so that neither is folded into the measurement loop.
+	[[gnu::noinline]] unsigned transform_view() {
+		unsigned sum = 0;
+		for (auto i : data | view::transform(square)) sum += i;
+		return sum;
+	}
+	[[gnu::noinline]] unsigned transform_loop() {
+		unsigned sum = 0;
+		for (auto i = data.begin(), e = data.end(); i != e; ++i) sum += square(*i);
+		return sum;
+	}
+
+	[[gnu::noinline]] unsigned filter_view() {
+		unsigned sum = 0;
+		for (int i : data | view::filter(even)) sum += i;
+		return sum;
+	}
+	[[gnu::noinline]] unsigned filter_loop() {
+		unsigned sum = 0;
+		for (auto i = data.begin(), e = data.end(); i != e; ++i) {
+			if (even(*i)) sum += *i;
+		}
+		return sum;
+	}
+
+	[[gnu::noinline]] unsigned take_view() {
+		unsigned sum = 0;
+		for (int i : data | view::take(n / 2)) sum += i;
+		return sum;
+	}
+	[[gnu::noinline]] unsigned take_loop() {
+		unsigned sum = 0;
+		auto const e = data.begin() + n / 2;
+		for (auto i = data.begin(); i != e; ++i) sum += *i;
+		return sum;
+	}
+
+	[[gnu::noinline]] unsigned iota_view() {
+		unsigned sum = 0;
+		for (int i : view::iota(0, n)) sum += i;
+		return sum;
+	}
+	[[gnu::noinline]] unsigned iota_loop() {
+		unsigned sum = 0;
+		for (int i = 0; i != n; ++i) sum += i;
+		return sum;
+	}
+
+	[[gnu::noinline]] unsigned pipeline_view() {
+		unsigned sum = 0;
+		for (auto i : view::iota(0) | view::filter(even) | view::transform(square) | view::take(n)) {
+			sum += i;
+		}
+		return sum;
+	}
+	[[gnu::noinline]] unsigned pipeline_loop() {
+		unsigned sum = 0;
+		int taken = 0;
+		for (int i = 0; taken != n; ++i) {
+			if (even(i)) {
+				sum += square(i);
+				++taken;
+			}
+		}
+		return sum;
+	}
+
+	// Fails if view costs more than limit times loop.
+	template<class V, class L>
+	void audit(counter& cost, V view, L loop, double limit) {
+		CHECK(view() == loop());
+		auto const v = cost(view);
+		auto const l = cost(loop);
+		double const ratio = l ? static_cast<double>(v) / static_cast<double>(l) : 1.0;
+		CHECK(ratio <= limit);
+	}
+}
+
+int main() {
+	for (int i = 0; i < n; ++i) {
+		data[i] = (i * 7919) % 1000;
+	}
+
+	counter cost;
+	double const limit = cost.exact() ? 1.2 : 2.0;
+	audit(cost, transform_view, transform_loop, limit);
+	audit(cost, filter_view, filter_loop, limit);
+	audit(cost, take_view, take_loop, limit);
+	audit(cost, iota_view, iota_loop, limit);
+	audit(cost, pipeline_view, pipeline_loop, limit);
+
+	return ::test_result();
+}
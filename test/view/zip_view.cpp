@@ -0,0 +1,179 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2017
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/zip.hpp>
+#include <stl2/detail/algorithm/partition.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/view/filter.hpp>
+#include <stl2/view/iota.hpp>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace view {
+	using namespace ranges::view;
+	using ranges::view::ext::zip;
+	using ranges::view::ext::zip_with;
+}
+
+using ranges::ext::common_tuple;
+
+int main() {
+	{
+		std::vector<int> keys{3, 1, 2};
+		std::vector<std::string> names{"c", "a", "b", "extra"};
+		auto rng = view::zip(keys, names);
+		using R = decltype(rng);
+		using I = ranges::iterator_t<R>;
+		static_assert(ranges::View<R>);
+		static_assert(ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::CommonRange<R>);
+		static_assert(ranges::Same<ranges::iter_reference_t<I>, common_tuple<int&, std::string&>>);
+		static_assert(ranges::Same<ranges::iter_value_t<I>, common_tuple<int, std::string>>);
+		static_assert(ranges::Same<ranges::iter_rvalue_reference_t<I>, common_tuple<int&&, std::string&&>>);
+		static_assert(ranges::Same<ranges::iter_common_reference_t<I>, common_tuple<int&, std::string&>>);
+		static_assert(ranges::Writable<I, common_tuple<int, std::string>>);
+		static_assert(ranges::Sortable<I>);
+
+		// Up to the end of the shortest.
+		CHECK(ranges::size(rng) == 3u);
+		CHECK((ranges::end(rng) - ranges::begin(rng)) == 3);
+		auto [k, n] = *ranges::begin(rng);
+		CHECK(k == 3);
+		CHECK(n == "c");
+		CHECK(&std::get<0>(ranges::begin(rng)[2]) == &keys[2]);
+
+		// Assignment goes through to the columns.
+		*ranges::begin(rng) = std::tuple<int, std::string>{4, "d"};
+		CHECK(keys[0] == 4);
+		CHECK(names[0] == "d");
+		ranges::iter_swap(ranges::begin(rng), ranges::begin(rng) + 1);
+		CHECK(keys[0] == 1);
+		CHECK(names[0] == "a");
+		CHECK(keys[1] == 4);
+		CHECK(names[1] == "d");
+
+		common_tuple<int, std::string> moved = ranges::iter_move(ranges::begin(rng) + 2);
+		CHECK(std::get<1>(moved) == "b");
+		CHECK(names[2].empty());
+	}
+	{
+		// Sorting the columns by a projection of one of them.
+		std::vector<int> keys{5, 2, 4, 1, 3};
+		std::vector<std::string> names{"e", "b", "d", "a", "c"};
+		std::vector<double> weights{5.0, 2.0, 4.0, 1.0, 3.0};
+		auto rng = view::zip(keys, names, weights);
+		auto const key = [](const auto& t) { return std::get<0>(t); };
+		ranges::sort(rng, ranges::less<>{}, key);
+		CHECK(keys == std::vector<int>{1, 2, 3, 4, 5});
+		CHECK(names == std::vector<std::string>{"a", "b", "c", "d", "e"});
+		CHECK(weights == std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0});
+
+		ranges::sort(rng, ranges::greater<>{}, [](const auto& t) { return std::get<1>(t); });
+		CHECK(keys == std::vector<int>{5, 4, 3, 2, 1});
+		CHECK(weights == std::vector<double>{5.0, 4.0, 3.0, 2.0, 1.0});
+	}
+	{
+		std::vector<int> keys{2, 1, 2, 1, 2, 1};
+		std::vector<int> order{0, 1, 2, 3, 4, 5};
+		auto rng = view::zip(keys, order);
+		ranges::stable_sort(rng, ranges::less<>{}, [](const auto& t) { return std::get<0>(t); });
+		CHECK(keys == std::vector<int>{1, 1, 1, 2, 2, 2});
+		CHECK(order == std::vector<int>{1, 3, 5, 0, 2, 4});
+
+		auto const odd = [](const auto& t) { return std::get<1>(t) % 2 != 0; };
+		auto const mid = ranges::partition(rng, odd);
+		CHECK((mid - ranges::begin(rng)) == 3);
+		for (auto i = ranges::begin(rng); i != mid; ++i) {
+			CHECK(odd(*i));
+			CHECK(std::get<0>(*i) == 1);
+		}
+		for (auto i = mid; i != ranges::end(rng); ++i) {
+			CHECK(!odd(*i));
+			CHECK(std::get<0>(*i) == 2);
+		}
+	}
+	{
+		// Move-only columns are moved and swapped, never copied.
+		std::vector<std::unique_ptr<int>> ps;
+		std::vector<int> keys{3, 1, 2};
+		for (int i : keys) {
+			ps.push_back(std::make_unique<int>(i * 10));
+		}
+		auto rng = view::zip(keys, ps);
+		ranges::sort(rng, ranges::less<>{}, [](const auto& t) { return std::get<0>(t); });
+		CHECK(keys == std::vector<int>{1, 2, 3});
+		CHECK(*ps[0] == 10);
+		CHECK(*ps[1] == 20);
+		CHECK(*ps[2] == 30);
+	}
+	{
+		// Bidirectional bases end in a sentinel.
+		std::list<int> l{1, 2, 3, 4};
+		std::vector<char> c{'a', 'b', 'c'};
+		auto rng = view::zip(l, c);
+		using R = decltype(rng);
+		static_assert(ranges::BidirectionalRange<R>);
+		static_assert(!ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(!ranges::CommonRange<R>);
+		CHECK(ranges::size(rng) == 3u);
+		int n = 0;
+		for (auto [i, ch] : rng) {
+			CHECK(i == n + 1);
+			CHECK(ch == 'a' + n);
+			++n;
+		}
+		CHECK(n == 3);
+
+		// A base that never ends doesn't count toward the size.
+		auto inf = view::zip(view::iota(0), c);
+		static_assert(ranges::RandomAccessRange<decltype(inf)>);
+		static_assert(ranges::SizedRange<decltype(inf)>);
+		static_assert(ranges::CommonRange<decltype(inf)>);
+		CHECK(ranges::size(inf) == 3u);
+		CHECK((ranges::end(inf) - ranges::begin(inf)) == 3);
+		CHECK(std::get<0>(*ranges::next(ranges::begin(inf), 2)) == 2);
+		static_assert(!ranges::SizedRange<decltype(view::zip(view::iota(0), view::iota(1)))>);
+	}
+	{
+		std::vector<int> a{1, 2, 3, 4};
+		std::vector<int> b{10, 20, 30};
+		auto sums = view::zip_with([](int x, int y) { return x + y; }, a, b);
+		using R = decltype(sums);
+		static_assert(ranges::View<R>);
+		static_assert(ranges::RandomAccessRange<R>);
+		static_assert(ranges::SizedRange<R>);
+		static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<R>>, int>);
+		CHECK_EQUAL(sums, {11, 22, 33});
+		CHECK(ranges::begin(sums)[2] == 33);
+		CHECK(ranges::size(sums) == 3u);
+
+		// A reference result is passed on as one.
+		auto firsts = view::zip_with([](int& x, int&) -> int& { return x; }, a, b);
+		static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<decltype(firsts)>>, int&>);
+		*ranges::begin(firsts) = 7;
+		CHECK(a[0] == 7);
+
+		// Bases that can't be iterated when const.
+		auto evens = a | view::filter([](int i) { return i % 2 == 0; });
+		auto products = view::zip_with([](int x, int y) { return x * y; }, evens, b);
+		CHECK_EQUAL(products, {20, 80});
+	}
+
+	return ::test_result();
+}